@@ -261,6 +261,7 @@ void delay_us(std::uint16_t us) noexcept;
 #define ICR5    test::Memory::data.reg16[95U]
 #define TCNT5   test::Memory::data.reg16[96U]
 #define OCR5B   test::Memory::data.reg16[97U]
+#define SP      test::Memory::data.reg16[98U]
 
 /** Mapping of AVR register bits and flags. */
 #define I_FLAG 7U
@@ -271,6 +272,8 @@ void delay_us(std::uint16_t us) noexcept;
 #define WDCE   4U
 #define WDE    3U
 #define WDRF   3U
+#define WDIE   6U
+#define WDIF   7U
 
 #define REFS0  6U
 #define ADEN   7U
@@ -279,6 +282,20 @@ void delay_us(std::uint16_t us) noexcept;
 #define ADPS1  1U
 #define ADPS2  2U
 #define ADIF   4U
+#define ADIE   3U
+
+#define SE     0U
+#define SM0    1U
+#define SM1    2U
+#define SM2    3U
+
+#define PRADC    0U
+#define PRUSART0 1U
+#define PRSPI    2U
+#define PRTIM1   3U
+#define PRTIM0   5U
+#define PRTIM2   6U
+#define PRTWI    7U
 
 #define CS01   1U
 #define CS11   1U
@@ -286,6 +303,7 @@ void delay_us(std::uint16_t us) noexcept;
 #define WGM12  3U
 #define TOIE0  0U
 #define OCIE1A 1U
+#define OCF1A  1U
 #define TOIE2  0U
 
 #define UDRE0  5U
@@ -298,6 +316,9 @@ void delay_us(std::uint16_t us) noexcept;
 #define EEPE  1U
 #define EEMPE 2U
 #define EERE  0U
+#define EERIE 3U
+#define EEPM0 4U
+#define EEPM1 5U
 
 /** Execute an assembly command. */
 #define asm(cmd) test::executeAssemblyCmd(cmd)
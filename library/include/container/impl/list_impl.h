@@ -32,7 +32,7 @@ template <typename T>
 List<T>::List() noexcept
     : myFirst{nullptr}
     , myLast{nullptr}
-    , mySize{nullptr} {}
+    , mySize{0U} {}
 
 // -----------------------------------------------------------------------------
 template <typename T>
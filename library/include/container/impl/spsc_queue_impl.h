@@ -0,0 +1,80 @@
+/**
+ * @brief Implementation details of container::SpscQueue class.
+ * 
+ * @note Don't include this header, use <spsc_queue.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+SpscQueue<T, Capacity>::SpscQueue() noexcept
+    : myData{}
+    , myHead{}
+    , myTail{}
+    , myOverflowCount{}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+constexpr uint8_t SpscQueue<T, Capacity>::capacity() noexcept { return Capacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+uint8_t SpscQueue<T, Capacity>::size() const noexcept 
+{ 
+    // The positions wrap around at 256, which is a multiple of the capacity.
+    return static_cast<uint8_t>(myHead - myTail); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+bool SpscQueue<T, Capacity>::isEmpty() const noexcept { return myHead == myTail; }
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+bool SpscQueue<T, Capacity>::isFull() const noexcept { return Capacity <= size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+bool SpscQueue<T, Capacity>::push(const T& value) noexcept
+{
+    // Drop the value if the queue is full.
+    if (isFull()) 
+    { 
+        myOverflowCount = myOverflowCount + 1U;
+        return false; 
+    }
+
+    // Store the value before publishing it by updating the write position.
+    const uint8_t head{myHead};
+    myData[index(head)] = value;
+    myHead = static_cast<uint8_t>(head + 1U);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+bool SpscQueue<T, Capacity>::pop(T& value) noexcept
+{
+    if (isEmpty()) { return false; }
+
+    // Read the value before releasing its slot by updating the read position.
+    const uint8_t tail{myTail};
+    value = myData[index(tail)];
+    myTail = static_cast<uint8_t>(tail + 1U);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+uint16_t SpscQueue<T, Capacity>::overflowCount() const noexcept { return myOverflowCount; }
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Capacity>
+constexpr uint8_t SpscQueue<T, Capacity>::index(const uint8_t position) noexcept
+{
+    return position & (Capacity - 1U);
+}
+} // namespace container
@@ -0,0 +1,126 @@
+/**
+ * @brief Implementation of lock-free single-producer/single-consumer queues.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace container
+{
+/**
+ * @brief Class for implementation of lock-free single-producer/single-consumer queues.
+ * 
+ *        The producer (typically an interrupt service routine) only pushes values, while the 
+ *        consumer (typically the main loop) only pops them. Each side only writes its own 
+ *        8-bit index, which is read and written atomically on an 8-bit MCU, so no critical 
+ *        sections are required.
+ * 
+ *        Several interrupt service routines may push to the same queue only as long as they 
+ *        can't preempt each other, since push is not reentrant. This holds on AVR, where 
+ *        interrupts don't nest unless an interrupt service routine re-enables them. Disable 
+ *        interrupts around push when pushing from thread context or from nested interrupts.
+ * 
+ *        Values pushed to a full queue are dropped and counted as overflows.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam T        The value type. Must be a scalar type, such as an integer or enum.
+ * @tparam Capacity The queue capacity. Must be a power of two in range [2, 128].
+ */
+template <typename T, uint8_t Capacity>
+class SpscQueue
+{
+    // Generate a compiler error if the capacity is invalid.
+    static_assert((Capacity >= 2U) && (Capacity <= 128U) && (0U == (Capacity & (Capacity - 1U))),
+                  "Queue capacity must be a power of two in range [2, 128]!");
+
+public:
+    /**
+     * @brief Create empty queue.
+     */
+    SpscQueue() noexcept;
+
+    /**
+     * @brief Delete queue.
+     */
+    ~SpscQueue() noexcept = default;
+
+    /**
+     * @brief Get the capacity of the queue.
+     * 
+     * @return The capacity of the queue.
+     */
+    static constexpr uint8_t capacity() noexcept;
+
+    /**
+     * @brief Get the number of values in the queue.
+     * 
+     * @return The number of values in the queue.
+     */
+    uint8_t size() const noexcept;
+
+    /**
+     * @brief Check whether the queue is empty.
+     * 
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * @brief Check whether the queue is full.
+     * 
+     * @return True if the queue is full, false otherwise.
+     */
+    bool isFull() const noexcept;
+
+    /**
+     * @brief Push value to the back of the queue. Only call from the producer.
+     * 
+     * @param[in] value The value to push.
+     * 
+     * @return True if the value was pushed, false if the queue is full.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * @brief Pop value from the front of the queue. Only call from the consumer.
+     * 
+     * @param[out] value Reference to variable to store the popped value.
+     * 
+     * @return True if a value was popped, false if the queue is empty.
+     */
+    bool pop(T& value) noexcept;
+
+    /**
+     * @brief Get the number of values dropped due to a full queue.
+     * 
+     *        The counter is 16 bits wide, so disable interrupts while reading it from the 
+     *        consumer on an 8-bit MCU.
+     * 
+     * @return The number of dropped values.
+     */
+    uint16_t overflowCount() const noexcept;
+
+    SpscQueue(const SpscQueue&)            = delete; // No copy constructor.
+    SpscQueue(SpscQueue&&)                 = delete; // No move constructor.
+    SpscQueue& operator=(const SpscQueue&) = delete; // No copy assignment.
+    SpscQueue& operator=(SpscQueue&&)      = delete; // No move assignment.
+
+private:
+    static constexpr uint8_t index(uint8_t position) noexcept;
+
+    /** Queue data. */
+    volatile T myData[Capacity];
+
+    /** Free-running write position, only updated by the producer. */
+    volatile uint8_t myHead;
+
+    /** Free-running read position, only updated by the consumer. */
+    volatile uint8_t myTail;
+
+    /** The number of values dropped due to a full queue, only updated by the producer. */
+    volatile uint16_t myOverflowCount;
+};
+} // namespace container
+
+#include "impl/spsc_queue_impl.h"
@@ -0,0 +1,112 @@
+/**
+ * @brief Crash log storing the context of the last watchdog timeout in EEPROM.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver 
+{
+/** EEPROM (Electrically Erasable Programmable ROM) stream interface. */
+namespace eeprom { class Interface; }
+} // namespace driver
+
+namespace diag
+{
+/**
+ * @brief Crash log storing the context of the last watchdog timeout in EEPROM.
+ * 
+ *        A single crash record is kept in a reserved EEPROM slot. The record is saved from the
+ *        watchdog interrupt right before the system is reset, then reported at startup.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class CrashLog
+{
+public:
+    /**
+     * @brief Structure of crash records.
+     */
+    struct Record
+    {
+        /** ID of the supervised task that missed its deadline (-1 = none). */
+        int8_t task;
+
+        /** The last event handled before the crash. */
+        uint8_t lastEvent;
+
+        /** Stack pointer at the time of the crash. */
+        uint16_t stackPointer;
+
+        /** Uptime at the time of the crash (in time base periods). */
+        uint16_t uptime;
+
+        /** The number of queued EEPROM writes at the time of the crash. */
+        uint8_t pendingWrites;
+    };
+
+    /** Size of the reserved EEPROM slot in bytes. */
+    static constexpr uint16_t SlotSize{sizeof(Record) + 1U};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] eeprom EEPROM stream to store the crash record in.
+     * @param[in] address Start address of the reserved EEPROM slot.
+     */
+    explicit CrashLog(driver::eeprom::Interface& eeprom, uint16_t address) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~CrashLog() noexcept = default;
+
+    /**
+     * @brief Save crash record. Blocking, since the system is reset shortly after.
+     * 
+     *        Safe to call from interrupt context: the record is written directly, leaving the 
+     *        queued EEPROM writes and the global interrupt state untouched.
+     * 
+     * @param[in] record The crash record to save.
+     * 
+     * @return True if the crash record was saved, false otherwise.
+     */
+    bool save(const Record& record) noexcept;
+
+    /**
+     * @brief Load the saved crash record, if any.
+     * 
+     * @param[out] record Reference to record for storing the crash record.
+     * 
+     * @return True if a crash record was loaded, false if no record is saved.
+     */
+    bool load(Record& record) const noexcept;
+
+    /**
+     * @brief Clear the saved crash record.
+     * 
+     * @return True if the crash record was cleared, false otherwise.
+     */
+    bool clear() noexcept;
+
+    /**
+     * @brief Get the current stack pointer.
+     * 
+     * @return The current stack pointer.
+     */
+    static uint16_t stackPointer() noexcept;
+
+    CrashLog()                           = delete; // No default constructor.
+    CrashLog(const CrashLog&)            = delete; // No copy constructor.
+    CrashLog(CrashLog&&)                 = delete; // No move constructor.
+    CrashLog& operator=(const CrashLog&) = delete; // No copy assignment.
+    CrashLog& operator=(CrashLog&&)      = delete; // No move assignment.
+
+private:
+    /** EEPROM stream to store the crash record in. */
+    driver::eeprom::Interface& myEeprom;
+
+    /** Start address of the reserved EEPROM slot. */
+    const uint16_t myAddress;
+};
+} // namespace diag
@@ -0,0 +1,107 @@
+/**
+ * @brief CPU load meter measuring the time spent sleeping and in interrupt service routines.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace diag
+{
+namespace load
+{
+/**
+ * @brief Scoped meter accounting the time until the end of the enclosing scope as interrupt time.
+ * 
+ *        Only use this class in interrupt context. Use the DIAG_ISR macro instead of this 
+ *        class directly, so the meter is compiled out unless DIAG_PROBES is defined.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class IsrScope
+{
+public:
+    /**
+     * @brief Constructor. Timestamp the entry of the interrupt service routine.
+     */
+    IsrScope() noexcept;
+
+    /**
+     * @brief Destructor. Account the time since the entry as interrupt time.
+     */
+    ~IsrScope() noexcept;
+
+    IsrScope(const IsrScope&)            = delete; // No copy constructor.
+    IsrScope(IsrScope&&)                 = delete; // No move constructor.
+    IsrScope& operator=(const IsrScope&) = delete; // No copy assignment.
+    IsrScope& operator=(IsrScope&&)      = delete; // No move assignment.
+
+private:
+    /** Timestamp of the entry. */
+    const uint16_t myStart;
+};
+
+/**
+ * @brief Indicate that the CPU is about to go to sleep. 
+ * 
+ *        Call right before putting the CPU to sleep. The sleep time must be shorter than the 
+ *        wraparound time of the probe time base (32.768 ms), which holds as long as a timer 
+ *        is running.
+ */
+void enterIdle() noexcept;
+
+/**
+ * @brief Indicate that the CPU has woken up. 
+ * 
+ *        Call right after the CPU has woken up. The time spent in instrumented interrupt 
+ *        service routines while sleeping is not counted as idle time.
+ */
+void exitIdle() noexcept;
+
+/**
+ * @brief Complete the current measurement window and start a new one.
+ * 
+ * @param[in] window_ms The length of the completed measurement window in ms.
+ */
+void update(uint16_t window_ms) noexcept;
+
+/**
+ * @brief Get the CPU load of the last completed measurement window.
+ * 
+ * @return The CPU load in percent.
+ */
+uint8_t cpuLoad() noexcept;
+
+/**
+ * @brief Get the peak CPU load since startup or the last reset.
+ * 
+ * @return The peak CPU load in percent.
+ */
+uint8_t peakLoad() noexcept;
+
+/**
+ * @brief Get the share of the CPU time spent in instrumented interrupt service routines 
+ *        during the last completed measurement window.
+ * 
+ * @return The interrupt share in percent (always 0 unless DIAG_PROBES is defined).
+ */
+uint8_t isrShare() noexcept;
+
+/**
+ * @brief Reset the peak CPU load.
+ */
+void resetPeak() noexcept;
+
+} // namespace load
+} // namespace diag
+
+#ifdef DIAG_PROBES
+
+/** Account the time from this point to the end of the enclosing scope as interrupt time. */
+#define DIAG_ISR() const diag::load::IsrScope diagIsrScope{}
+
+#else
+
+/** Interrupt time is only measured if DIAG_PROBES is defined. */
+#define DIAG_ISR()
+
+#endif /** DIAG_PROBES */
@@ -0,0 +1,178 @@
+/**
+ * @brief Latency probes measuring the execution time of code paths.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver 
+{
+/** Serial transmission interface. */
+namespace serial { class Interface; }
+} // namespace driver
+
+namespace diag
+{
+namespace probe
+{
+/**
+ * @brief Structure of probe IDs.
+ */
+struct Id
+{
+    /** Timer interrupt service routines, including the timer callbacks. */
+    static constexpr uint8_t TimerIsr{0U};
+
+    /** Button event handler. */
+    static constexpr uint8_t ButtonEvent{1U};
+
+    /** Debounce timer timeout handler. */
+    static constexpr uint8_t DebounceTimeout{2U};
+
+    /** Toggle timer timeout handler. */
+    static constexpr uint8_t ToggleTimeout{3U};
+
+    /** Tick timer timeout handler. */
+    static constexpr uint8_t TickTimeout{4U};
+
+    /** Scheduled tasks run by the scheduler. */
+    static constexpr uint8_t ScheduledTasks{5U};
+
+    /** EEPROM write sequence, run with interrupts disabled. */
+    static constexpr uint8_t EepromWrite{6U};
+
+    /** Watchdog configuration sequence, run with interrupts disabled. */
+    static constexpr uint8_t WatchdogWrite{7U};
+
+    /** The number of probes. */
+    static constexpr uint8_t Count{8U};
+};
+
+/** The number of histogram buckets per probe. */
+constexpr uint8_t BucketCount{8U};
+
+/**
+ * @brief Structure of probe statistics.
+ * 
+ *        Durations are measured in time base counts, see toMicroseconds. Histogram bucket i 
+ *        holds the durations below 4 << i us, while the last bucket holds all longer durations.
+ */
+struct Stats
+{
+    /** Sum of the measured durations. */
+    uint32_t sum;
+
+    /** The number of measurements (saturates at the maximum value). */
+    uint16_t count;
+
+    /** The shortest measured duration. */
+    uint16_t min;
+
+    /** The longest measured duration. */
+    uint16_t max;
+
+    /** The number of measurements per histogram bucket. */
+    uint16_t histogram[BucketCount];
+};
+
+/**
+ * @brief Scoped probe measuring the time between its construction and destruction.
+ * 
+ *        Use the DIAG_PROBE macro instead of this class directly, so the probe is compiled 
+ *        out unless DIAG_PROBES is defined.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Scope
+{
+public:
+    /**
+     * @brief Constructor. Timestamp the entry of the measured code path.
+     * 
+     * @param[in] id The probe ID.
+     */
+    explicit Scope(uint8_t id) noexcept;
+
+    /**
+     * @brief Destructor. Timestamp the exit of the measured code path and record the duration.
+     */
+    ~Scope() noexcept;
+
+    Scope()                        = delete; // No default constructor.
+    Scope(const Scope&)            = delete; // No copy constructor.
+    Scope(Scope&&)                 = delete; // No move constructor.
+    Scope& operator=(const Scope&) = delete; // No copy assignment.
+    Scope& operator=(Scope&&)      = delete; // No move assignment.
+
+private:
+    /** Timestamp of the entry. */
+    const uint16_t myStart;
+
+    /** The probe ID. */
+    const uint8_t myId;
+};
+
+/**
+ * @brief Get the current time of the time base.
+ * 
+ *        Timer 1 is used as time base, which is running freely with prescaler 8 (0.5 us per 
+ *        count at 16 MHz) once reserved by the timer driver. The time wraps around every 
+ *        32.768 ms, which limits the longest measurable duration.
+ * 
+ * @return The current time in time base counts.
+ */
+uint16_t now() noexcept;
+
+/**
+ * @brief Convert duration in time base counts to microseconds.
+ * 
+ * @param[in] duration The duration in time base counts.
+ * 
+ * @return The corresponding duration in microseconds.
+ */
+constexpr uint32_t toMicroseconds(const uint32_t duration) noexcept { return duration / 2U; }
+
+/**
+ * @brief Record measured duration. This function is safe to call from interrupt context.
+ * 
+ * @param[in] id The probe ID. Invalid IDs are ignored.
+ * @param[in] duration The measured duration in time base counts.
+ */
+void record(uint8_t id, uint16_t duration) noexcept;
+
+/**
+ * @brief Get the statistics of given probe.
+ * 
+ * @param[in] id The probe ID.
+ * @param[out] stats Reference to structure for storing the statistics.
+ * 
+ * @return True if the statistics were read, false if the probe ID is invalid.
+ */
+bool stats(uint8_t id, Stats& stats) noexcept;
+
+/**
+ * @brief Reset the statistics of all probes.
+ */
+void reset() noexcept;
+
+/**
+ * @brief Print the statistics of all probes with at least one measurement.
+ * 
+ * @param[in] serial Serial device to print the statistics with.
+ */
+void print(const driver::serial::Interface& serial) noexcept;
+
+} // namespace probe
+} // namespace diag
+
+#ifdef DIAG_PROBES
+
+/** Measure the execution time from this point to the end of the enclosing scope. */
+#define DIAG_PROBE(id) const diag::probe::Scope diagProbeScope{id}
+
+#else
+
+/** Probes are compiled out unless DIAG_PROBES is defined. */
+#define DIAG_PROBE(id)
+
+#endif /** DIAG_PROBES */
@@ -0,0 +1,58 @@
+/**
+ * @brief Stack painting and high-water mark measurement.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace diag
+{
+namespace stack
+{
+/** Pattern painted on the unused stack at startup. */
+constexpr uint8_t Pattern{0xC5U};
+
+/**
+ * @brief Paint memory region with the stack pattern.
+ * 
+ * @param[in] begin Start of the region.
+ * @param[in] end End of the region (exclusive).
+ */
+void paint(uint8_t* begin, const uint8_t* end) noexcept;
+
+/**
+ * @brief Get the number of bytes still holding the stack pattern, counted from the start of
+ *        the region up to the first overwritten byte.
+ * 
+ *        The stack grows downwards, so the painted bytes at the start of the region have never
+ *        been used by the stack.
+ * 
+ * @param[in] begin Start of the region.
+ * @param[in] end End of the region (exclusive).
+ * 
+ * @return The number of unused bytes.
+ */
+uint16_t unusedBytes(const uint8_t* begin, const uint8_t* end) noexcept;
+
+/**
+ * @brief Get the number of bytes between the heap and the deepest stack position reached 
+ *        since startup.
+ * 
+ *        On target, the RAM between the static data and the top of the stack is painted before
+ *        main is called. The test suite has no painted stack, hence 0 is always returned.
+ * 
+ * @return The number of stack bytes that have never been used.
+ */
+uint16_t unusedBytes() noexcept;
+
+/**
+ * @brief Get the deepest stack depth reached since startup (the high-water mark).
+ * 
+ *        The test suite has no painted stack, hence 0 is always returned.
+ * 
+ * @return The maximum stack depth in bytes.
+ */
+uint16_t maxDepth() noexcept;
+
+} // namespace stack
+} // namespace diag
@@ -0,0 +1,149 @@
+/**
+ * @brief RAM trace buffer of timestamped events.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver 
+{
+/** Serial transmission interface. */
+namespace serial { class Interface; }
+} // namespace driver
+
+namespace diag
+{
+namespace trace
+{
+/**
+ * @brief Structure of trace event IDs. Keep in sync with test/scripts/trace_decode.py.
+ */
+struct Id
+{
+    /** Logic event handled, the argument holds the event. */
+    static constexpr uint8_t LogicEvent{0U};
+
+    /** Scheduled task started, the argument holds the task ID. */
+    static constexpr uint8_t TaskStart{1U};
+
+    /** Scheduled task completed, the argument holds the task ID. */
+    static constexpr uint8_t TaskEnd{2U};
+
+    /** CPU going to sleep. */
+    static constexpr uint8_t Sleep{3U};
+
+    /** CPU woken up. */
+    static constexpr uint8_t Wake{4U};
+
+    /** EEPROM byte written, the argument holds the address. */
+    static constexpr uint8_t EepromWrite{5U};
+
+    /** Temperature sampled, the argument holds the temperature in degrees Celsius. */
+    static constexpr uint8_t Temperature{6U};
+
+    /** Scheduled task deadline missed, the argument holds the total number of misses. */
+    static constexpr uint8_t DeadlineMiss{7U};
+
+    /** The number of trace event IDs. */
+    static constexpr uint8_t Count{8U};
+};
+
+/** Capacity of the trace buffer in records. Must be a power of two. */
+constexpr uint8_t Capacity{32U};
+
+/**
+ * @brief Structure of trace records.
+ */
+struct Record
+{
+    /** Timestamp in probe time base counts (0.5 us), wraps around every 32.768 ms. */
+    uint16_t time;
+
+    /** Event argument. */
+    uint16_t arg;
+
+    /** Event ID. */
+    uint8_t id;
+};
+
+/**
+ * @brief Record trace event. This function is safe to call from interrupt context.
+ * 
+ *        Use the DIAG_TRACE macro instead of this function directly, so the trace is compiled 
+ *        out unless DIAG_TRACING is defined. When the buffer is full, the oldest record is 
+ *        overwritten. Events are ignored while the trace is frozen.
+ * 
+ * @param[in] id The event ID.
+ * @param[in] arg The event argument.
+ */
+void record(uint8_t id, uint16_t arg = 0U) noexcept;
+
+/**
+ * @brief Set trigger freezing the trace after given event.
+ * 
+ *        Once the trigger event has been recorded, given number of events are recorded 
+ *        before the trace is frozen, so the events both before and after the trigger are kept.
+ * 
+ * @param[in] id The trigger event ID.
+ * @param[in] postCount The number of events to record after the trigger event.
+ */
+void setTrigger(uint8_t id, uint8_t postCount) noexcept;
+
+/**
+ * @brief Freeze the trace immediately.
+ */
+void freeze() noexcept;
+
+/**
+ * @brief Check whether the trace is frozen.
+ * 
+ * @return True if the trace is frozen, false otherwise.
+ */
+bool isFrozen() noexcept;
+
+/**
+ * @brief Get the number of records in the trace buffer.
+ * 
+ * @return The number of records.
+ */
+uint8_t size() noexcept;
+
+/**
+ * @brief Get trace record.
+ * 
+ * @param[in] index The index of the record, where 0 is the oldest record.
+ * @param[out] record Reference to structure for storing the record.
+ * 
+ * @return True if the record was read, false if the index is out of range.
+ */
+bool read(uint8_t index, Record& record) noexcept;
+
+/**
+ * @brief Clear the trace buffer and unfreeze the trace. The trigger is re-armed.
+ */
+void reset() noexcept;
+
+/**
+ * @brief Print the trace records, oldest first. Decode the output with 
+ *        test/scripts/trace_decode.py.
+ * 
+ *        The trace is frozen while printing. The records are kept.
+ * 
+ * @param[in] serial Serial device to print the records with.
+ */
+void print(const driver::serial::Interface& serial) noexcept;
+
+} // namespace trace
+} // namespace diag
+
+#ifdef DIAG_TRACING
+
+/** Record trace event with given ID and argument. */
+#define DIAG_TRACE(id, arg) diag::trace::record(id, arg)
+
+#else
+
+/** Trace events are compiled out unless DIAG_TRACING is defined. */
+#define DIAG_TRACE(id, arg)
+
+#endif /** DIAG_TRACING */
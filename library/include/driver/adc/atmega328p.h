@@ -16,6 +16,12 @@ namespace adc
  * 
  *        Use the singleton design pattern to ensure only one ADC instance exists,
  *        reflecting the hardware limitation of a single ADC on the MCU.
+ * 
+ *        In noise reduction read mode, the CPU sleeps in ADC noise reduction mode during each 
+ *        conversion and is woken by the ADC interrupt once the conversion is complete. 
+ *        Timers clocked by the I/O clock are halted during the conversion. Reads performed 
+ *        while interrupts are disabled, such as from interrupt service routines, fall back to 
+ *        polling, since the CPU cannot be woken up.
  */
 class Atmega328p final : public Interface
 {
@@ -51,6 +57,13 @@ public:
      */
     double supplyVoltage() const noexcept override;
 
+    /**
+     * @brief Get the supply voltage of the ADC.
+     * 
+     * @return The supply voltage of the ADC in millivolts.
+     */
+    uint16_t supplyVoltage_mV() const noexcept override;
+
     /**
      * @brief Read input from given channel.
      * 
@@ -78,6 +91,24 @@ public:
      */
     double inputVoltage(uint8_t channel) const noexcept override;
 
+    /**
+     * @brief Calculate duty cycle out of input from given channel without floating-point math.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The duty cycle in unsigned Q1.15 format, i.e. 0 - 32768 corresponds to 0.0 - 1.0.
+     */
+    uint16_t dutyCycle_q15(uint8_t channel) const noexcept override;
+
+    /**
+     * @brief Read input voltage from given channel without floating-point math.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The input voltage in millivolts, rounded to the nearest integer.
+     */
+    uint16_t inputVoltage_mV(uint8_t channel) const noexcept override;
+
     /**
      * @brief Check whether the ADC is initialized.
      * 
@@ -99,6 +130,22 @@ public:
      */
     void setEnabled(bool enable) noexcept override;
 
+    /**
+     * @brief Get the read mode of the ADC.
+     * 
+     * @return The read mode of the ADC.
+     */
+    ReadMode readMode() const noexcept override;
+
+    /**
+     * @brief Set read mode of the ADC.
+     * 
+     * @param[in] mode The new read mode.
+     * 
+     * @return True if the read mode was set, false if the given read mode is invalid.
+     */
+    bool setReadMode(ReadMode mode) noexcept override;
+
     /**
      * @brief Check whether the given channel is valid.
      * 
@@ -117,6 +164,9 @@ private:
     Atmega328p() noexcept;
     ~Atmega328p() noexcept override = default;
 
+    /** ADC read mode. */
+    ReadMode myReadMode;
+
     /** Indicate whether the ADC is enabled. */
     bool myEnabled;
 };
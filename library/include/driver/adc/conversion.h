@@ -0,0 +1,52 @@
+/**
+ * @brief Integer conversion of ADC (A/D converter) values.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace adc
+{
+namespace conversion
+{
+/** The number of fractional bits of duty cycles in Q1.15 format. */
+constexpr uint8_t DutyCycleShift{15U};
+
+/**
+ * @brief Convert an ADC value to a duty cycle without floating-point math.
+ * 
+ * @param[in] adcVal The ADC value to convert.
+ * @param[in] maxVal The maximum digital value of the ADC.
+ * 
+ * @return The duty cycle in unsigned Q1.15 format, i.e. 0 - 32768 corresponds to 0.0 - 1.0.
+ *         0 is returned if the maximum value is 0.
+ */
+constexpr uint16_t dutyCycle_q15(const uint16_t adcVal, const uint16_t maxVal) noexcept
+{
+    // Round to the nearest integer by adding half the divisor before dividing.
+    return 0U < maxVal ? static_cast<uint16_t>(
+        ((static_cast<uint32_t>(adcVal) << DutyCycleShift) + maxVal / 2U) / maxVal) : 0U;
+}
+
+/**
+ * @brief Convert an ADC value to an input voltage without floating-point math.
+ * 
+ * @param[in] adcVal The ADC value to convert.
+ * @param[in] maxVal The maximum digital value of the ADC.
+ * @param[in] supplyVoltage_mV The supply voltage of the ADC in millivolts.
+ * 
+ * @return The input voltage in millivolts, rounded to the nearest integer.
+ *         0 is returned if the maximum value is 0.
+ */
+constexpr uint16_t inputVoltage_mV(const uint16_t adcVal, const uint16_t maxVal, 
+                                   const uint16_t supplyVoltage_mV) noexcept
+{
+    // Round to the nearest integer by adding half the divisor before dividing.
+    return 0U < maxVal ? static_cast<uint16_t>(
+        (static_cast<uint32_t>(adcVal) * supplyVoltage_mV + maxVal / 2U) / maxVal) : 0U;
+}
+} // namespace conversion
+} // namespace adc
+} // namespace driver
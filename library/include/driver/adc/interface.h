@@ -10,6 +10,16 @@ namespace driver
 {
 namespace adc
 {
+/**
+ * @brief Enumeration of ADC read modes.
+ */
+enum class ReadMode : uint8_t
+{
+    Polling,        // Busy-wait for the conversion to complete while the CPU is active.
+    NoiseReduction, // Sleep in ADC noise reduction mode until the conversion is complete.
+    Count,          // Number of supported read modes.
+};
+
 /**
  * @brief ADC (A/D converter) interface.
  */
@@ -42,6 +52,13 @@ public:
      */
     virtual double supplyVoltage() const noexcept = 0;
 
+    /**
+     * @brief Get the supply voltage of the ADC.
+     * 
+     * @return The supply voltage of the ADC in millivolts.
+     */
+    virtual uint16_t supplyVoltage_mV() const noexcept = 0;
+
     /**
      * @brief Read input from given channel.
      * 
@@ -69,6 +86,24 @@ public:
      */
     virtual double inputVoltage(uint8_t channel) const noexcept = 0;
 
+    /**
+     * @brief Calculate duty cycle out of input from given channel without floating-point math.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The duty cycle in unsigned Q1.15 format, i.e. 0 - 32768 corresponds to 0.0 - 1.0.
+     */
+    virtual uint16_t dutyCycle_q15(uint8_t channel) const noexcept = 0;
+
+    /**
+     * @brief Read input voltage from given channel without floating-point math.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The input voltage in millivolts, rounded to the nearest integer.
+     */
+    virtual uint16_t inputVoltage_mV(uint8_t channel) const noexcept = 0;
+
     /**
      * @brief Check whether the ADC is initialized.
      * 
@@ -90,6 +125,22 @@ public:
      */
     virtual void setEnabled(bool enable) noexcept = 0;
 
+    /**
+     * @brief Get the read mode of the ADC.
+     * 
+     * @return The read mode of the ADC.
+     */
+    virtual ReadMode readMode() const noexcept = 0;
+
+    /**
+     * @brief Set read mode of the ADC.
+     * 
+     * @param[in] mode The new read mode.
+     * 
+     * @return True if the read mode was set, false if the given read mode is invalid.
+     */
+    virtual bool setReadMode(ReadMode mode) noexcept = 0;
+
     /**
      * @brief Check whether the given channel is valid.
      * 
@@ -6,7 +6,9 @@
 #include <math.h>
 #include <stdint.h>
 
+#include "driver/adc/conversion.h"
 #include "driver/adc/interface.h"
+#include "utils/utils.h"
 
 namespace driver 
 {
@@ -28,9 +30,11 @@ public:
      */
     explicit Stub(const uint8_t resolution = 10U, const double supplyVoltage = 5.0) noexcept
         : mySupplyVoltage{supplyVoltage}
+        , mySupplyVoltage_mV{utils::round<uint16_t>(supplyVoltage * 1000.0)}
         , myMaxVal{static_cast<uint16_t>(pow(2U, resolution) - 1U)}
         , myAdcVal{}
         , myResolution{resolution}
+        , myReadMode{ReadMode::Polling}
         , myInitialized{true}
         , myEnabled{true}
         , myChannelValid{true}
@@ -62,6 +66,13 @@ public:
      */
     double supplyVoltage() const noexcept override { return mySupplyVoltage; }
 
+    /**
+     * @brief Get the supply voltage of the ADC.
+     * 
+     * @return The supply voltage of the ADC in millivolts.
+     */
+    uint16_t supplyVoltage_mV() const noexcept override { return mySupplyVoltage_mV; }
+
     /**
      * @brief Read input from given channel.
      * 
@@ -100,6 +111,30 @@ public:
         return dutyCycle(channel) * mySupplyVoltage;
     }
 
+    /**
+     * @brief Calculate duty cycle out of input from given channel without floating-point math.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The duty cycle in unsigned Q1.15 format, i.e. 0 - 32768 corresponds to 0.0 - 1.0.
+     */
+    uint16_t dutyCycle_q15(const uint8_t channel) const noexcept override
+    {
+        return conversion::dutyCycle_q15(read(channel), myMaxVal);
+    }
+
+    /**
+     * @brief Read input voltage from given channel without floating-point math.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The input voltage in millivolts, rounded to the nearest integer.
+     */
+    uint16_t inputVoltage_mV(const uint8_t channel) const noexcept override
+    {
+        return conversion::inputVoltage_mV(read(channel), myMaxVal, mySupplyVoltage_mV);
+    }
+
     /**
      * @brief Check whether the ADC is initialized.
      * 
@@ -121,6 +156,28 @@ public:
      */
     void setEnabled(const bool enable) noexcept override { myEnabled = enable; }
 
+    /**
+     * @brief Get the read mode of the ADC.
+     * 
+     * @return The read mode of the ADC.
+     */
+    ReadMode readMode() const noexcept override { return myReadMode; }
+
+    /**
+     * @brief Set read mode of the ADC.
+     * 
+     * @param[in] mode The new read mode.
+     * 
+     * @return True if the read mode was set, false if the given read mode is invalid.
+     */
+    bool setReadMode(const ReadMode mode) noexcept override
+    {
+        // Check the read mode, return false if invalid.
+        if (ReadMode::Count <= mode) { return false; }
+        myReadMode = mode;
+        return true;
+    }
+
     /**
      * @brief Check whether the given channel is valid.
      * 
@@ -168,6 +225,9 @@ private:
     /** Supply voltage. */
     const double mySupplyVoltage;
 
+    /** Supply voltage in millivolts. */
+    const uint16_t mySupplyVoltage_mV;
+
     /** ADC max value. */
     const uint16_t myMaxVal;
 
@@ -177,6 +237,9 @@ private:
     /** ADC resolution. */
     const uint8_t myResolution;
 
+    /** ADC read mode. */
+    ReadMode myReadMode;
+
     /** Indicate whether the ADC is initialized. */
     bool myInitialized;
 
@@ -16,6 +16,10 @@ namespace eeprom
  * 
  *        Use the singleton design pattern to ensure only one EEPROM instance exists,
  *        reflecting the hardware limitation of a single EEPROM on the MCU.
+ * 
+ *        Asynchronous writes are stored in a write queue, which is drained one byte at a time
+ *        by the EEPROM ready interrupt. Blocking writes are performed after all queued writes,
+ *        while reads of addresses with pending writes return the queued data.
  */
 class Atmega328p final : public Interface
 {
@@ -55,6 +59,18 @@ public:
      */
     void setEnabled(bool enable) noexcept override;
 
+    /**
+     * @brief Block until all queued writes are complete.
+     */
+    void flush() noexcept override;
+
+    /**
+     * @brief Get the number of bytes queued for writing.
+     * 
+     * @return The number of bytes queued for writing.
+     */
+    uint16_t pendingWrites() const noexcept override;
+
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
     Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
@@ -63,9 +79,13 @@ public:
 private: 
     Atmega328p() noexcept;
     ~Atmega328p() noexcept override = default;
-    bool isAddressValid(uint16_t address, uint8_t dataSize) const noexcept override;
-    void writeByte(uint16_t address, uint8_t data) noexcept override;
+    bool isAddressValid(uint16_t address, uint16_t dataSize) const noexcept override;
+    void writeByte(uint16_t address, uint8_t data, bool erase) noexcept override;
     uint8_t readByte(uint16_t address) const noexcept override;
+    void writeByteFromIsr(uint16_t address, uint8_t data, bool erase) noexcept override;
+    uint8_t readByteFromIsr(uint16_t address) const noexcept override;
+    bool enqueue(uint16_t address, const uint8_t* data, uint8_t size, 
+                 void (*callback)()) noexcept override;
 
     /** Indicate whether the EEPROM stream is enabled. */
     bool myEnabled;
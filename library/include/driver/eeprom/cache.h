@@ -0,0 +1,190 @@
+/**
+ * @brief Write-through RAM cache for an EEPROM window.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/eeprom/interface.h"
+
+namespace driver 
+{
+namespace eeprom
+{
+/**
+ * @brief Write-through RAM cache for an EEPROM window.
+ * 
+ *        The cache wraps an EEPROM stream and keeps a RAM copy of a window of the EEPROM. 
+ *        The window is loaded in a single pass once the stream is enabled. Reads within the 
+ *        window are then served from RAM, while all writes are forwarded to the stream and 
+ *        update the RAM copy. Accesses outside the window are forwarded as is.
+ * 
+ *        All writes to the cached window must go through the cache to keep the RAM copy coherent.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam WindowSize The size of the cached window in bytes.
+ */
+template <uint16_t WindowSize>
+class Cache final : public Interface
+{
+public:
+    // Generate a compiler error if the window size is set to 0.
+    static_assert(0U < WindowSize, "EEPROM cache window size must be larger than 0!");
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] eeprom EEPROM stream to cache.
+     * @param[in] windowStart Start address of the cached window.
+     */
+    explicit Cache(Interface& eeprom, uint16_t windowStart) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Cache() noexcept override = default;
+
+    /**
+     * @brief Get the size of the EEPROM.
+     * 
+     * @return The size of the EEPROM in bytes.
+     */
+    uint16_t size() const noexcept override;
+
+    /**
+     * @brief Check whether the EEPROM stream is initialized.
+     * 
+     * @return True if the EEPROM stream is initialized and the window fits, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Indicate whether the EEPROM stream is enabled.
+     * 
+     * @return True if the EEPROM stream is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Set enablement of EEPROM stream. The window is loaded when first enabled.
+     * 
+     * @param[in] enable Indicate whether to enable the EEPROM stream.
+     */
+    void setEnabled(bool enable) noexcept override;
+
+    /**
+     * @brief Block until all queued writes are complete.
+     */
+    void flush() noexcept override;
+
+    /**
+     * @brief Get the number of bytes queued for writing.
+     * 
+     * @return The number of bytes queued for writing.
+     */
+    uint16_t pendingWrites() const noexcept override;
+
+    /**
+     * @brief Check whether the window has been loaded into RAM.
+     * 
+     * @return True if the window is loaded, false otherwise.
+     */
+    bool isLoaded() const noexcept;
+
+    Cache()                        = delete; // No default constructor.
+    Cache(const Cache&)            = delete; // No copy constructor.
+    Cache(Cache&&)                 = delete; // No move constructor.
+    Cache& operator=(const Cache&) = delete; // No copy assignment.
+    Cache& operator=(Cache&&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Load the window into RAM, if possible.
+     */
+    void load() noexcept;
+
+    /**
+     * @brief Check whether the given address is cached.
+     * 
+     * @param[in] address The address to check.
+     * 
+     * @return True if the address is cached, false otherwise.
+     */
+    bool isCached(uint16_t address) const noexcept;
+
+    /**
+     * @brief Check whether the given address is valid.
+     * 
+     * @param[in] address Starting address.
+     * @param[in] dataSize Data size in bytes.
+     * 
+     * @return True if the address is valid, false otherwise.
+     */
+    bool isAddressValid(uint16_t address, uint16_t dataSize) const noexcept override;
+
+    /**
+     * @brief Write byte in EEPROM, update the cached copy.
+     * 
+     * @param[in] address Destination address.
+     * @param[in] data Data to write.
+     * @param[in] erase True to erase the byte before writing, false to only clear bits.
+     */
+    void writeByte(uint16_t address, uint8_t data, bool erase) noexcept override;
+
+    /**
+     * @brief Read byte in EEPROM, served from RAM within the window.
+     * 
+     * @param[in] address The address to read from.
+     * 
+     * @return The data at the given address.
+     */
+    uint8_t readByte(uint16_t address) const noexcept override;
+
+    /**
+     * @brief Write byte in EEPROM from interrupt context, update the cached copy.
+     * 
+     * @param[in] address Destination address.
+     * @param[in] data Data to write.
+     * @param[in] erase True to erase the byte before writing, false to only clear bits.
+     */
+    void writeByteFromIsr(uint16_t address, uint8_t data, bool erase) noexcept override;
+
+    /**
+     * @brief Read the stored byte in EEPROM from interrupt context, bypassing the cache.
+     * 
+     * @param[in] address The address to read from.
+     * 
+     * @return The data stored at the given address.
+     */
+    uint8_t readByteFromIsr(uint16_t address) const noexcept override;
+
+    /**
+     * @brief Queue bytes to write in EEPROM, update the cached copy once queued.
+     * 
+     * @param[in] address Destination address of the first byte.
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The number of bytes to write.
+     * @param[in] callback Callback to invoke once all bytes have been written (nullptr = none).
+     * 
+     * @return True if the data was queued, false otherwise.
+     */
+    bool enqueue(uint16_t address, const uint8_t* data, uint8_t size, 
+                 void (*callback)()) noexcept override;
+
+    /** EEPROM stream to cache. */
+    Interface& myEeprom;
+
+    /** Start address of the cached window. */
+    const uint16_t myWindowStart;
+
+    /** RAM copy of the cached window. */
+    uint8_t myWindow[WindowSize];
+
+    /** Indicate whether the window has been loaded into RAM. */
+    bool myLoaded;
+};
+} // namespace eeprom
+} // namespace driver
+
+#include "impl/cache_impl.h"
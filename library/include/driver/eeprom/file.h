@@ -0,0 +1,176 @@
+/**
+ * @brief File-backed EEPROM stream for the host platform.
+ */
+#ifdef TESTSUITE
+
+#pragma once
+
+#include <cstdint>
+
+#include "driver/eeprom/interface.h"
+
+namespace driver 
+{
+namespace eeprom
+{
+/**
+ * @brief File-backed EEPROM stream for the host platform.
+ * 
+ *        The EEPROM content is stored in a memory-mapped image file, which persists across
+ *        program runs and instances, i.e. a new instance opened on the same file simulates 
+ *        a power cycle. A new image file is created in erased state (all bytes 0xFF).
+ * 
+ *        Write timing is simulated in virtual time: each write keeps the EEPROM busy for
+ *        3.4 ms (erase and write) or 1.8 ms (write only), and subsequent accesses wait until 
+ *        the EEPROM is ready. The number of writes of each cell is recorded to evaluate wear.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class File final : public Interface
+{
+public:
+    /** Size of the EEPROM in bytes. */
+    static constexpr std::uint16_t Size{1024U};
+
+    /** Erase and write time in microseconds. */
+    static constexpr std::uint32_t EraseWriteTime_us{3400U};
+
+    /** Write only time in microseconds. */
+    static constexpr std::uint32_t WriteOnlyTime_us{1800U};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] path Path to the image file. The file is created if it doesn't exist.
+     */
+    explicit File(const char* path) noexcept;
+
+    /**
+     * @brief Destructor. The image file is synchronized and unmapped.
+     */
+    ~File() noexcept override;
+
+    /**
+     * @brief Get the size of the EEPROM.
+     * 
+     * @return The size of the EEPROM in bytes.
+     */
+    std::uint16_t size() const noexcept override;
+
+    /**
+     * @brief Check whether the EEPROM stream is initialized, i.e. the image file is mapped.
+     * 
+     * @return True if the EEPROM stream is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Indicate whether the EEPROM stream is enabled.
+     * 
+     * @return True if the EEPROM stream is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Set enablement of EEPROM stream.
+     * 
+     * @param[in] enable Indicate whether to enable the EEPROM stream.
+     */
+    void setEnabled(bool enable) noexcept override;
+
+    /**
+     * @brief Block until all queued writes are complete.
+     * 
+     *        Queued writes are performed immediately, so only the ongoing write is awaited.
+     */
+    void flush() noexcept override;
+
+    /**
+     * @brief Get the number of bytes queued for writing.
+     * 
+     * @return The number of bytes queued for writing (always 0).
+     */
+    std::uint16_t pendingWrites() const noexcept override;
+
+    /**
+     * @brief Check whether a write is ongoing at the current virtual time.
+     * 
+     * @return True if a write is ongoing, false otherwise.
+     */
+    bool isBusy() const noexcept;
+
+    /**
+     * @brief Get the current virtual time.
+     * 
+     * @return The virtual time in microseconds since the instance was created.
+     */
+    std::uint64_t time_us() const noexcept;
+
+    /**
+     * @brief Advance the virtual time, e.g. to simulate the program running between accesses.
+     * 
+     * @param[in] duration_us The duration to advance in microseconds.
+     */
+    void advanceTime(std::uint64_t duration_us) noexcept;
+
+    /**
+     * @brief Get the number of writes of given cell since the instance was created.
+     * 
+     * @param[in] address The address of the cell.
+     * 
+     * @return The number of writes of the cell, or 0 if the address is invalid.
+     */
+    std::uint32_t writeCount(std::uint16_t address) const noexcept;
+
+    /**
+     * @brief Get the highest number of writes of any cell since the instance was created.
+     * 
+     * @return The highest number of writes of a single cell.
+     */
+    std::uint32_t maxWriteCount() const noexcept;
+
+    /**
+     * @brief Get the total number of writes since the instance was created.
+     * 
+     * @return The total number of writes.
+     */
+    std::uint32_t totalWriteCount() const noexcept;
+
+    File()                       = delete; // No default constructor.
+    File(const File&)            = delete; // No copy constructor.
+    File(File&&)                 = delete; // No move constructor.
+    File& operator=(const File&) = delete; // No copy assignment.
+    File& operator=(File&&)      = delete; // No move assignment.
+
+private:
+    void waitUntilReady() const noexcept;
+    bool isAddressValid(std::uint16_t address, std::uint16_t dataSize) const noexcept override;
+    void writeByte(std::uint16_t address, std::uint8_t data, bool erase) noexcept override;
+    std::uint8_t readByte(std::uint16_t address) const noexcept override;
+    void writeByteFromIsr(std::uint16_t address, std::uint8_t data, bool erase) noexcept override;
+    std::uint8_t readByteFromIsr(std::uint16_t address) const noexcept override;
+    bool enqueue(std::uint16_t address, const std::uint8_t* data, std::uint8_t size, 
+                 void (*callback)()) noexcept override;
+
+    /** Memory-mapped image file (nullptr if not mapped). */
+    std::uint8_t* myImage;
+
+    /** File descriptor of the image file (-1 if not open). */
+    int myFileDescriptor;
+
+    /** Virtual time in microseconds, advanced while waiting for the EEPROM to be ready. */
+    mutable std::uint64_t myTime_us;
+
+    /** Virtual time at which the ongoing write is complete. */
+    std::uint64_t myReadyTime_us;
+
+    /** The number of writes of each cell. */
+    std::uint32_t myWriteCount[Size];
+
+    /** Indicate whether the EEPROM stream is enabled. */
+    bool myEnabled;
+};
+} // namespace eeprom
+} // namespace driver
+
+#endif /** TESTSUITE */
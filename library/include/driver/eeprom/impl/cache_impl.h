@@ -0,0 +1,139 @@
+/**
+ * @brief Implementation details of driver::eeprom::Cache class.
+ * 
+ * @note Don't include this header, use <cache.h> instead!
+ */
+#pragma once
+
+namespace driver
+{
+namespace eeprom
+{
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+Cache<WindowSize>::Cache(Interface& eeprom, const uint16_t windowStart) noexcept
+    : myEeprom{eeprom}
+    , myWindowStart{windowStart}
+    , myWindow{}
+    , myLoaded{false}
+{
+    load();
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+uint16_t Cache<WindowSize>::size() const noexcept { return myEeprom.size(); }
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+bool Cache<WindowSize>::isInitialized() const noexcept
+{
+    return myEeprom.isInitialized() 
+        && Interface::isAddressValid(myEeprom, myWindowStart, WindowSize);
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+bool Cache<WindowSize>::isEnabled() const noexcept { return myEeprom.isEnabled(); }
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+void Cache<WindowSize>::setEnabled(const bool enable) noexcept
+{
+    myEeprom.setEnabled(enable);
+    if (enable && !myLoaded) { load(); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+void Cache<WindowSize>::flush() noexcept { myEeprom.flush(); }
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+uint16_t Cache<WindowSize>::pendingWrites() const noexcept { return myEeprom.pendingWrites(); }
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+bool Cache<WindowSize>::isLoaded() const noexcept { return myLoaded; }
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+void Cache<WindowSize>::load() noexcept
+{
+    myLoaded = isInitialized() && myEeprom.readBlock(myWindowStart, myWindow, WindowSize);
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+bool Cache<WindowSize>::isCached(const uint16_t address) const noexcept
+{
+    return myLoaded && (myWindowStart <= address) && (address - myWindowStart < WindowSize);
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+bool Cache<WindowSize>::isAddressValid(const uint16_t address, 
+                                       const uint16_t dataSize) const noexcept
+{
+    return Interface::isAddressValid(myEeprom, address, dataSize);
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+void Cache<WindowSize>::writeByte(const uint16_t address, const uint8_t data, 
+                                  const bool erase) noexcept
+{
+    Interface::writeByte(myEeprom, address, data, erase);
+
+    if (isCached(address))
+    {
+        uint8_t& cached{myWindow[address - myWindowStart]};
+        cached = erase ? data : cached & data;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+uint8_t Cache<WindowSize>::readByte(const uint16_t address) const noexcept
+{
+    return isCached(address) ? myWindow[address - myWindowStart] 
+                             : Interface::readByte(myEeprom, address);
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+void Cache<WindowSize>::writeByteFromIsr(const uint16_t address, const uint8_t data, 
+                                         const bool erase) noexcept
+{
+    Interface::writeByteFromIsr(myEeprom, address, data, erase);
+
+    if (isCached(address))
+    {
+        uint8_t& cached{myWindow[address - myWindowStart]};
+        cached = erase ? data : cached & data;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+uint8_t Cache<WindowSize>::readByteFromIsr(const uint16_t address) const noexcept
+{
+    return Interface::readByteFromIsr(myEeprom, address);
+}
+
+// -----------------------------------------------------------------------------
+template <uint16_t WindowSize>
+bool Cache<WindowSize>::enqueue(const uint16_t address, const uint8_t* data, const uint8_t size, 
+                                void (*callback)()) noexcept
+{
+    if (!Interface::enqueue(myEeprom, address, data, size, callback)) { return false; }
+
+    // Queued data is returned on read, so update the cached copy right away.
+    for (uint8_t i{}; i < size; ++i)
+    {
+        if (isCached(address + i)) { myWindow[address + i - myWindowStart] = data[i]; }
+    }
+    return true;
+}
+} // namespace eeprom
+} // namespace driver
@@ -0,0 +1,161 @@
+/**
+ * @brief Implementation details of driver::eeprom::Slot class.
+ * 
+ * @note Don't include this header, use <slot.h> instead!
+ */
+#pragma once
+
+namespace driver
+{
+namespace eeprom
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+Slot<T>::Slot(Interface& eeprom, const uint16_t startAddress, const uint16_t regionSize) noexcept
+    : myEeprom{eeprom}
+    , myStartAddress{startAddress}
+    , myRecordCount{static_cast<uint16_t>(regionSize / RecordSize)}
+    , myIndex{}
+    , mySequence{}
+    , myRestored{false}
+    , myEmpty{true}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Slot<T>::isInitialized() const noexcept
+{
+    // Return true if the region fits at least two records within the EEPROM.
+    return myEeprom.isInitialized() && (2U <= myRecordCount)
+        && (myEeprom.size() >= static_cast<uint32_t>(myStartAddress) 
+                               + static_cast<uint32_t>(myRecordCount) * RecordSize);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Slot<T>::isRestored() const noexcept { return myRestored; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Slot<T>::isEmpty() const noexcept { return myEmpty; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+uint16_t Slot<T>::recordCount() const noexcept { return myRecordCount; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+uint16_t Slot<T>::sequence() const noexcept { return mySequence; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Slot<T>::restore() noexcept
+{
+    // Return false if the region is invalid or if the EEPROM stream isn't enabled.
+    if (!isInitialized() || !myEeprom.isEnabled()) { return false; }
+    myEmpty    = true;
+    myRestored = true;
+
+    // Find the latest record, i.e. the first valid record not followed by its successor.
+    // Only the sequence numbers are read during the scan.
+    uint16_t sequence{readSequence(0U)};
+
+    for (uint16_t i{}; i < myRecordCount; ++i)
+    {
+        const uint16_t next{nextIndex(i)};
+        const uint16_t nextSeq{readSequence(next)};
+
+        if ((ErasedSequence != sequence) && (nextSequence(sequence) != nextSeq))
+        {
+            myIndex    = i;
+            mySequence = sequence;
+            myEmpty    = false;
+            break;
+        }
+        sequence = nextSeq;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Slot<T>::read(T& value) const noexcept
+{
+    // Return false if no value is available.
+    if (!myRestored || myEmpty) { return false; }
+    return myEeprom.read(recordAddress(myIndex), value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Slot<T>::write(const T& value) noexcept
+{
+    // Locate the latest record first, return false on failure.
+    if (!myRestored && !restore()) { return false; }
+
+    // Skip the write if the given value is already stored.
+    T storedValue{};
+    if (read(storedValue) && (storedValue == value)) { return true; }
+
+    // Write the value to the next record, then mark it as the latest record.
+    const uint16_t index{myEmpty ? static_cast<uint16_t>(0U) : nextIndex(myIndex)};
+    const uint16_t sequence{myEmpty ? static_cast<uint16_t>(0U) : nextSequence(mySequence)};
+    const uint16_t address{recordAddress(index)};
+
+    // The latest record stays intact if the sequence number can't be queued.
+    if (!queueWrite(address, value) 
+        || !queueWrite(static_cast<uint16_t>(address + sizeof(T)), sequence)) 
+    { 
+        return false; 
+    }
+    myIndex    = index;
+    mySequence = sequence;
+    myEmpty    = false;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr uint16_t Slot<T>::nextSequence(const uint16_t sequence) noexcept
+{
+    // Skip the sequence number of erased records.
+    return (ErasedSequence - 1U) == sequence ? 0U : sequence + 1U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+uint16_t Slot<T>::nextIndex(const uint16_t index) const noexcept
+{
+    // Wrap around to the first record after the last one.
+    return (myRecordCount - 1U) == index ? 0U : index + 1U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+uint16_t Slot<T>::recordAddress(const uint16_t index) const noexcept
+{
+    return myStartAddress + index * RecordSize;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+uint16_t Slot<T>::readSequence(const uint16_t index) const noexcept
+{
+    // Treat unreadable records as erased.
+    uint16_t sequence{};
+    return myEeprom.read(static_cast<uint16_t>(recordAddress(index) + sizeof(T)), sequence) ? 
+        sequence : ErasedSequence;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U>
+bool Slot<T>::queueWrite(const uint16_t address, const U& data) noexcept
+{
+    // Complete the queued writes and retry once if the write queue is full.
+    if (myEeprom.writeAsync(address, data)) { return true; }
+    myEeprom.flush();
+    return myEeprom.writeAsync(address, data);
+}
+} // namespace eeprom
+} // namespace driver
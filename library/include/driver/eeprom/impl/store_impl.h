@@ -0,0 +1,418 @@
+/**
+ * @brief Implementation details of driver::eeprom::Store class.
+ * 
+ * @note Don't include this header, use <store.h> instead!
+ */
+#pragma once
+
+namespace driver
+{
+namespace eeprom
+{
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+Store<KeyCount>::Store(Interface& eeprom, const uint16_t startAddress, 
+                       const uint16_t regionSize) noexcept
+    : myEeprom{eeprom}
+    , myStartAddress{startAddress}
+    , myBankSize{static_cast<uint16_t>(regionSize / 2U)}
+    , myIndex{}
+    , myGeneration{}
+    , myEnd{}
+    , myDeadSpace{}
+    , myCompactEnd{}
+    , myBank{}
+    , myCompactKey{}
+    , myRestored{false}
+    , myCompacting{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::isInitialized() const noexcept
+{
+    // Return true if both banks fit a header and at least one record within the EEPROM.
+    return myEeprom.isInitialized() && (HeaderSize + RecordHeaderSize < myBankSize)
+        && (myEeprom.size() > static_cast<uint32_t>(myStartAddress) + 2U * myBankSize);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::isRestored() const noexcept { return myRestored; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::restore() noexcept
+{
+    // Return false if the region is invalid or if the EEPROM stream isn't enabled.
+    if (!isInitialized() || !myEeprom.isEnabled()) { return false; }
+    uint16_t generation[2U]{};
+
+    if (!myEeprom.read(bankStart(0U), generation[0U]) 
+        || !myEeprom.read(bankStart(1U), generation[1U])) 
+    { 
+        return false; 
+    }
+
+    if ((InvalidGeneration == generation[0U]) && (InvalidGeneration == generation[1U]))
+    {
+        // Format an empty store: mark the first bank as active and terminate its log.
+        if (!myEeprom.updateObject(bankStart(0U), static_cast<uint16_t>(0U))
+            || !programByte(bankStart(0U) + HeaderSize, FreeKey))
+        {
+            return false;
+        }
+        generation[0U] = 0U;
+    }
+
+    // Select the valid bank of the newest generation (the generation numbers wrap around).
+    if (InvalidGeneration == generation[0U]) { myBank = 1U; }
+    else if (InvalidGeneration == generation[1U]) { myBank = 0U; }
+    else 
+    { 
+        const uint16_t age{static_cast<uint16_t>(generation[1U] - generation[0U])};
+        myBank = (0U < age) && (age < 0x8000U) ? 1U : 0U;
+    }
+    myGeneration = generation[myBank];
+    myCompacting = false;
+    scan();
+    myRestored = true;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::contains(const uint8_t key) const noexcept
+{
+    return myRestored && (KeyCount > key) && (NoRecord != myIndex[key]);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint8_t Store<KeyCount>::length(const uint8_t key) const noexcept
+{
+    return contains(key) ? readByte(myIndex[key] + 1U) : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::readBlock(const uint8_t key, void* data, const uint8_t size) const noexcept
+{
+    // Return false if no value of the given size is stored.
+    if ((nullptr == data) || !contains(key) || (length(key) != size)) { return false; }
+    return myEeprom.readBlock(myIndex[key] + RecordHeaderSize, data, size);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::writeBlock(const uint8_t key, const void* data, const uint8_t size) noexcept
+{
+    // Return false if the parameters are invalid or if the store isn't restored.
+    if ((nullptr == data) || (KeyCount <= key) || (!myRestored && !restore())) { return false; }
+    const uint16_t previous{myIndex[key]};
+
+    // Update values of unchanged length in place, otherwise append a new record, then mark 
+    // the previous record dead.
+    if ((NoRecord != previous) && (readByte(previous + 1U) == size))
+    {
+        if (!myEeprom.updateBlock(previous + RecordHeaderSize, data, size)) { return false; }
+    }
+    else
+    {
+        const uint16_t address{myEnd};
+        if (!appendRecord(myEnd, myBank, key, data, size)) { return false; }
+        myIndex[key] = address;
+        if (NoRecord != previous) { killRecord(previous); }
+    }
+
+    // Keep the copy in the target bank up to date during compaction.
+    updateCopy(key);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+template <typename T>
+bool Store<KeyCount>::read(const uint8_t key, T& value) const noexcept
+{
+    // Generate a compiler error if the given type can't be copied byte by byte.
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+        "EEPROM store only supported for trivially copyable types!");
+    static_assert(255U >= sizeof(T), "EEPROM store values are limited to 255 bytes!");
+    return readBlock(key, &value, sizeof(T));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+template <typename T>
+bool Store<KeyCount>::write(const uint8_t key, const T& value) noexcept
+{
+    // Generate a compiler error if the given type can't be copied byte by byte.
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+        "EEPROM store only supported for trivially copyable types!");
+    static_assert(255U >= sizeof(T), "EEPROM store values are limited to 255 bytes!");
+    return writeBlock(key, &value, sizeof(T));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::remove(const uint8_t key) noexcept
+{
+    // Return false if no value is stored.
+    if (!contains(key)) { return false; }
+    killRecord(myIndex[key]);
+    myIndex[key] = NoRecord;
+    updateCopy(key);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint16_t Store<KeyCount>::freeSpace() const noexcept 
+{ 
+    return myRestored ? bankEnd(myBank) - myEnd : 0U; 
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint16_t Store<KeyCount>::deadSpace() const noexcept { return myDeadSpace; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::isCompacting() const noexcept { return myCompacting; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::compactStep() noexcept
+{
+    if (!myRestored) { return false; }
+    const uint8_t target{static_cast<uint8_t>(1U - myBank)};
+
+    if (!myCompacting)
+    {
+        // Start a compaction if there are dead records to reclaim.
+        // Invalidate the target bank first, so it isn't selected if a reset occurs.
+        if ((0U == myDeadSpace) 
+            || !myEeprom.updateObject(bankStart(target), InvalidGeneration)
+            || !programByte(bankStart(target) + HeaderSize, FreeKey)) 
+        { 
+            return false; 
+        }
+        myCompactEnd = bankStart(target) + HeaderSize;
+        myCompactKey = 0U;
+        myCompacting = true;
+        return true;
+    }
+
+    // Skip keys without value, then copy the next live record to the target bank.
+    while ((KeyCount > myCompactKey) && (NoRecord == myIndex[myCompactKey])) { ++myCompactKey; }
+
+    if (KeyCount > myCompactKey)
+    {
+        if (!appendCopy(myIndex[myCompactKey]))
+        {
+            cancelCompaction();
+            return false;
+        }
+        ++myCompactKey;
+        return true;
+    }
+
+    // All live records are copied, commit the target bank by writing its generation number.
+    const uint16_t generation{nextGeneration(myGeneration)};
+    if (!myEeprom.updateObject(bankStart(target), generation)) 
+    { 
+        cancelCompaction();
+        return false; 
+    }
+    myBank       = target;
+    myGeneration = generation;
+    myCompacting = false;
+    scan();
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+constexpr uint8_t Store<KeyCount>::toKeyByte(const uint8_t key) noexcept 
+{ 
+    // Offset the keys, since key byte 0 marks dead records.
+    return key + 1U; 
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+constexpr uint16_t Store<KeyCount>::nextGeneration(const uint16_t generation) noexcept
+{
+    // Skip the generation number of invalid banks.
+    return (InvalidGeneration - 1U) == generation ? 0U : generation + 1U;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint16_t Store<KeyCount>::bankStart(const uint8_t bank) const noexcept
+{
+    return myStartAddress + bank * myBankSize;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint16_t Store<KeyCount>::bankEnd(const uint8_t bank) const noexcept
+{
+    return bankStart(bank) + myBankSize;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint8_t Store<KeyCount>::readByte(const uint16_t address) const noexcept
+{
+    // Treat unreadable bytes as free.
+    uint8_t data{};
+    return myEeprom.read(address, data) ? data : FreeKey;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::programByte(const uint16_t address, const uint8_t data) noexcept
+{
+    return myEeprom.updateBlock(address, &data, sizeof(data));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint16_t Store<KeyCount>::recordSize(const uint16_t address) const noexcept
+{
+    return RecordHeaderSize + readByte(address + 1U);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::appendRecord(uint16_t& end, const uint8_t bank, const uint8_t key, 
+                                   const void* data, const uint8_t size) noexcept
+{
+    // Return false if the record doesn't fit in the bank.
+    const uint16_t recordEnd{static_cast<uint16_t>(end + RecordHeaderSize + size)};
+    if (bankEnd(bank) < recordEnd) { return false; }
+
+    // Terminate the log after the record, write the length and data, then commit the record
+    // by writing its key.
+    if (((bankEnd(bank) > recordEnd) && !programByte(recordEnd, FreeKey))
+        || !programByte(end + 1U, size)
+        || !myEeprom.updateBlock(end + RecordHeaderSize, data, size)
+        || !programByte(end, toKeyByte(key)))
+    {
+        return false;
+    }
+    end = recordEnd;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::copyRecord(const uint16_t source, const uint16_t destination) noexcept
+{
+    // Copy the length and data one byte at a time, then commit the record by writing its key.
+    const uint16_t size{recordSize(source)};
+
+    for (uint16_t i{1U}; i < size; ++i)
+    {
+        if (!programByte(destination + i, readByte(source + i))) { return false; }
+    }
+    return programByte(destination, readByte(source));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+void Store<KeyCount>::killRecord(const uint16_t address) noexcept
+{
+    // Clearing the key byte only clears bits, so no erase is required.
+    programByte(address, DeadKey);
+    myDeadSpace += recordSize(address);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+void Store<KeyCount>::scan() noexcept
+{
+    // Build the index by walking the log of the active bank.
+    for (uint8_t i{}; i < KeyCount; ++i) { myIndex[i] = NoRecord; }
+    myDeadSpace = 0U;
+    myEnd       = bankStart(myBank) + HeaderSize;
+
+    while (bankEnd(myBank) >= myEnd + RecordHeaderSize)
+    {
+        // Stop at the end of the log or at a truncated record.
+        const uint8_t keyByte{readByte(myEnd)};
+        const uint16_t size{recordSize(myEnd)};
+        if ((FreeKey == keyByte) || (bankEnd(myBank) < myEnd + size)) { break; }
+
+        if ((DeadKey == keyByte) || (KeyCount < keyByte)) { myDeadSpace += size; }
+        else
+        {
+            // Keep the newest record of each key, mark older records dead.
+            const uint8_t key{static_cast<uint8_t>(keyByte - 1U)};
+            if (NoRecord != myIndex[key]) { killRecord(myIndex[key]); }
+            myIndex[key] = myEnd;
+        }
+        myEnd += size;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+bool Store<KeyCount>::appendCopy(const uint16_t source) noexcept
+{
+    // Return false if the record doesn't fit in the target bank.
+    const uint8_t target{static_cast<uint8_t>(1U - myBank)};
+    const uint16_t destination{myCompactEnd};
+    const uint16_t end{static_cast<uint16_t>(destination + recordSize(source))};
+    if (bankEnd(target) < end) { return false; }
+
+    // Terminate the target log before committing the copied record.
+    if (((bankEnd(target) > end) && !programByte(end, FreeKey)) 
+        || !copyRecord(source, destination))
+    {
+        return false;
+    }
+    myCompactEnd = end;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+uint16_t Store<KeyCount>::findCopy(const uint8_t key) const noexcept
+{
+    // Walk the records copied so far, which is only done on writes during compaction.
+    const uint8_t target{static_cast<uint8_t>(1U - myBank)};
+
+    for (uint16_t address{static_cast<uint16_t>(bankStart(target) + HeaderSize)}; 
+         address < myCompactEnd; address += recordSize(address))
+    {
+        if (toKeyByte(key) == readByte(address)) { return address; }
+    }
+    return NoRecord;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+void Store<KeyCount>::updateCopy(const uint8_t key) noexcept
+{
+    // Keys not copied yet are copied with their current record later on.
+    if (!myCompacting || (myCompactKey <= key)) { return; }
+
+    // Mark the outdated copy dead, then copy the current record (if any). The compaction is 
+    // cancelled if the target bank is full.
+    const uint16_t copy{findCopy(key)};
+    if (NoRecord != copy) { programByte(copy, DeadKey); }
+    if ((NoRecord != myIndex[key]) && !appendCopy(myIndex[key])) { cancelCompaction(); }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t KeyCount>
+void Store<KeyCount>::cancelCompaction() noexcept
+{
+    // The target bank remains invalid, so it's ignored at startup.
+    myCompacting = false;
+}
+} // namespace eeprom
+} // namespace driver
@@ -78,10 +78,163 @@ public:
     template <typename T = uint8_t>
     bool read(uint16_t address, T& data) const noexcept;
 
-private: 
-    virtual bool isAddressValid(uint16_t address, uint8_t dataSize) const noexcept = 0;
-    virtual void writeByte(uint16_t address, uint8_t data) noexcept = 0;
+    /**
+     * @brief Read a block of data from EEPROM, starting at given address.
+     * 
+     * @param[in] address The start address.
+     * @param[out] data Pointer to buffer for storing the data read.
+     * @param[in] size The number of bytes to read.
+     * 
+     * @return True upon successful read, false otherwise.
+     */
+    bool readBlock(uint16_t address, void* data, uint16_t size) const noexcept;
+
+    /**
+     * @brief Update a block of data in EEPROM, starting at given address.
+     * 
+     *        Each byte is compared with the stored byte first. Unchanged bytes are skipped and
+     *        bytes where only bits are to be cleared are programmed without prior erase, which 
+     *        takes about half the time of an erase and write.
+     * 
+     * @param[in] address The start address.
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The number of bytes to write.
+     * 
+     * @return True upon successful update, false otherwise.
+     */
+    bool updateBlock(uint16_t address, const void* data, uint16_t size) noexcept;
+
+    /**
+     * @brief Update a block of data in EEPROM from interrupt context, starting at given address.
+     * 
+     *        The bytes are programmed directly, bypassing the write queue. Queued writes are 
+     *        neither drained nor completed, so no write callbacks are invoked, and the global 
+     *        interrupt state of the caller is left unchanged. Blocking, only intended for 
+     *        last-resort writes such as saving a crash record right before a reset.
+     * 
+     * @param[in] address The start address.
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The number of bytes to write.
+     * 
+     * @return True upon successful update, false otherwise.
+     */
+    bool updateBlockFromIsr(uint16_t address, const void* data, uint16_t size) noexcept;
+
+    /**
+     * @brief Read object from given address in EEPROM.
+     * 
+     * @tparam T The object type. Must be trivially copyable.
+     * 
+     * @param[in] address The start address.
+     * @param[out] object Reference to object for storing the data read.
+     * 
+     * @return True upon successful read, false otherwise.
+     */
+    template <typename T>
+    bool readObject(uint16_t address, T& object) const noexcept;
+
+    /**
+     * @brief Update object at given address in EEPROM, skipping unchanged bytes.
+     * 
+     * @tparam T The object type. Must be trivially copyable.
+     * 
+     * @param[in] address The start address.
+     * @param[in] object The object to write.
+     * 
+     * @return True upon successful update, false otherwise.
+     */
+    template <typename T>
+    bool updateObject(uint16_t address, const T& object) noexcept;
+
+    /**
+     * @brief Update object at given address in EEPROM from interrupt context.
+     * 
+     *        See updateBlockFromIsr for details.
+     * 
+     * @tparam T The object type. Must be trivially copyable.
+     * 
+     * @param[in] address The start address.
+     * @param[in] object The object to write.
+     * 
+     * @return True upon successful update, false otherwise.
+     */
+    template <typename T>
+    bool updateObjectFromIsr(uint16_t address, const T& object) noexcept;
+
+    /**
+     * @brief Queue data to be written to given address in EEPROM without blocking. If more than 
+     *        one byte is to be written, the other bytes are written to the consecutive addresses.
+     * 
+     *        Either all bytes are queued or none of them.
+     * 
+     * @tparam T The data type of the data to write. Must be unsigned.
+     *
+     * @param[in] address The destination address.
+     * @param[in] data The data to write to the destination address.
+     * @param[in] callback Callback to invoke once all bytes have been written (default = none).
+     *                     The callback may be invoked from interrupt context.
+     *
+     * @return True if the data was queued, false otherwise.
+     */
+    template <typename T = uint8_t>
+    bool writeAsync(uint16_t address, const T& data, void (*callback)() = nullptr) noexcept;
+
+    /**
+     * @brief Block until all queued writes are complete.
+     */
+    virtual void flush() noexcept = 0;
+
+    /**
+     * @brief Get the number of bytes queued for writing.
+     * 
+     * @return The number of bytes queued for writing.
+     */
+    virtual uint16_t pendingWrites() const noexcept = 0;
+
+protected: 
+    virtual bool isAddressValid(uint16_t address, uint16_t dataSize) const noexcept = 0;
+    virtual void writeByte(uint16_t address, uint8_t data, bool erase) noexcept = 0;
     virtual uint8_t readByte(uint16_t address) const noexcept = 0;
+    virtual void writeByteFromIsr(uint16_t address, uint8_t data, bool erase) noexcept = 0;
+    virtual uint8_t readByteFromIsr(uint16_t address) const noexcept = 0;
+    virtual bool enqueue(uint16_t address, const uint8_t* data, uint8_t size, 
+                         void (*callback)()) noexcept = 0;
+
+    // Forward byte accesses to another EEPROM stream, used by streams wrapping other streams.
+    // Protected members can only be called on objects of the derived type otherwise.
+    static bool isAddressValid(const Interface& eeprom, const uint16_t address, 
+                               const uint16_t dataSize) noexcept
+    {
+        return eeprom.isAddressValid(address, dataSize);
+    }
+
+    static void writeByte(Interface& eeprom, const uint16_t address, const uint8_t data, 
+                          const bool erase) noexcept
+    {
+        eeprom.writeByte(address, data, erase);
+    }
+
+    static uint8_t readByte(const Interface& eeprom, const uint16_t address) noexcept
+    {
+        return eeprom.readByte(address);
+    }
+
+    static void writeByteFromIsr(Interface& eeprom, const uint16_t address, const uint8_t data, 
+                                 const bool erase) noexcept
+    {
+        eeprom.writeByteFromIsr(address, data, erase);
+    }
+
+    static uint8_t readByteFromIsr(const Interface& eeprom, const uint16_t address) noexcept
+    {
+        return eeprom.readByteFromIsr(address);
+    }
+
+    static bool enqueue(Interface& eeprom, const uint16_t address, const uint8_t* data, 
+                        const uint8_t size, void (*callback)()) noexcept
+    {
+        return eeprom.enqueue(address, data, size, callback);
+    }
 };
 
 // -----------------------------------------------------------------------------
@@ -98,7 +251,7 @@ bool Interface::write(const uint16_t address, const T& data) noexcept
     // Write each byte to EEPROM, one at a time.
     for (uint8_t i{}; i < sizeof(T); ++i)
     {
-        writeByte(address + i, static_cast<uint8_t>(data >> (8U * i)));
+        writeByte(address + i, static_cast<uint8_t>(data >> (8U * i)), true);
     }
     // Return true to indicate success.
     return true;
@@ -124,5 +277,56 @@ bool Interface::read(const uint16_t address, T& data) const noexcept
     // Return true to indicate success.
     return true;
 }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Interface::readObject(const uint16_t address, T& object) const noexcept
+{
+    // Generate a compiler error if the given type can't be copied byte by byte.
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+        "EEPROM object read only supported for trivially copyable types!");
+    return readBlock(address, &object, sizeof(T));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Interface::updateObject(const uint16_t address, const T& object) noexcept
+{
+    // Generate a compiler error if the given type can't be copied byte by byte.
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+        "EEPROM object update only supported for trivially copyable types!");
+    return updateBlock(address, &object, sizeof(T));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Interface::updateObjectFromIsr(const uint16_t address, const T& object) noexcept
+{
+    // Generate a compiler error if the given type can't be copied byte by byte.
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+        "EEPROM object update only supported for trivially copyable types!");
+    return updateBlockFromIsr(address, &object, sizeof(T));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Interface::writeAsync(const uint16_t address, const T& data, void (*callback)()) noexcept
+{
+    // Generate a compiler error if the given type isn't of unsigned type.
+    static_assert(type_traits::is_unsigned<T>::value, 
+        "EEPROM write only supported for unsigned data types!");
+
+    // Return false is the given address in invalid or if the EEPROM stream isn't enabled.
+    if (!isAddressValid(address, sizeof(T)) || !isEnabled()) { return false; }
+
+    // Split the data into bytes, then queue all bytes at once.
+    uint8_t bytes[sizeof(T)]{};
+
+    for (uint8_t i{}; i < sizeof(T); ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(data >> (8U * i));
+    }
+    return enqueue(address, bytes, sizeof(T), callback);
+}
 } // namespace eeprom
 } // namespace driver
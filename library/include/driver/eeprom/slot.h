@@ -0,0 +1,162 @@
+/**
+ * @brief Wear-leveled EEPROM slot for frequently updated values.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/eeprom/interface.h"
+#include "utils/type_traits.h"
+
+namespace driver 
+{
+namespace eeprom
+{
+/**
+ * @brief Wear-leveled EEPROM slot for frequently updated values.
+ * 
+ *        The slot rotates writes across a region of EEPROM. Each record holds a value followed 
+ *        by a 16-bit sequence number, which is written last so that an interrupted write leaves 
+ *        the previous record intact. The latest record is found at startup by scanning the 
+ *        sequence numbers of the region.
+ * 
+ *        Writes are queued via the asynchronous write queue of the EEPROM stream.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam T The value type. Must be unsigned.
+ */
+template <typename T>
+class Slot
+{
+public:
+    // Generate a compiler error if the given type isn't of unsigned type.
+    static_assert(type_traits::is_unsigned<T>::value, 
+        "EEPROM slots only supported for unsigned data types!");
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] eeprom EEPROM stream to store the records in.
+     * @param[in] startAddress Start address of the EEPROM region.
+     * @param[in] regionSize Size of the EEPROM region in bytes. Must fit at least two records.
+     */
+    explicit Slot(Interface& eeprom, uint16_t startAddress, uint16_t regionSize) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Slot() noexcept = default;
+
+    /**
+     * @brief Check whether the slot is initialized.
+     * 
+     * @return True if the slot is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept;
+
+    /**
+     * @brief Check whether the slot is restored, i.e. the latest record has been located.
+     * 
+     * @return True if the slot is restored, false otherwise.
+     */
+    bool isRestored() const noexcept;
+
+    /**
+     * @brief Check whether the slot is empty, i.e. no value has been stored yet.
+     * 
+     * @return True if the slot is empty, false otherwise.
+     */
+    bool isEmpty() const noexcept;
+
+    /**
+     * @brief Get the number of records the EEPROM region is divided into.
+     * 
+     * @return The number of records.
+     */
+    uint16_t recordCount() const noexcept;
+
+    /**
+     * @brief Get the sequence number of the latest record.
+     * 
+     * @return The sequence number of the latest record.
+     */
+    uint16_t sequence() const noexcept;
+
+    /**
+     * @brief Locate the latest record by scanning the EEPROM region.
+     * 
+     *        The EEPROM stream must be enabled.
+     * 
+     * @return True if the slot was restored, false otherwise.
+     */
+    bool restore() noexcept;
+
+    /**
+     * @brief Read the latest value from the slot.
+     * 
+     * @param[out] value Reference to variable for storing the value.
+     * 
+     * @return True if the value was read, false if the slot is empty or not restored.
+     */
+    bool read(T& value) const noexcept;
+
+    /**
+     * @brief Write value to the slot.
+     * 
+     *        The value is written to the record after the latest one. The write is skipped if 
+     *        the given value is already stored. If the write queue is full, the queued writes 
+     *        are completed first, which blocks the caller.
+     * 
+     * @param[in] value The value to write.
+     * 
+     * @return True if the value was written, false otherwise.
+     */
+    bool write(const T& value) noexcept;
+
+    Slot()                       = delete; // No default constructor.
+    Slot(const Slot&)            = delete; // No copy constructor.
+    Slot(Slot&&)                 = delete; // No move constructor.
+    Slot& operator=(const Slot&) = delete; // No copy assignment.
+    Slot& operator=(Slot&&)      = delete; // No move assignment.
+
+private:
+    /** Sequence number of erased records. */
+    static constexpr uint16_t ErasedSequence{0xFFFFU};
+
+    /** Record size in bytes. */
+    static constexpr uint16_t RecordSize{sizeof(T) + sizeof(uint16_t)};
+
+    static constexpr uint16_t nextSequence(uint16_t sequence) noexcept;
+    uint16_t nextIndex(uint16_t index) const noexcept;
+    uint16_t recordAddress(uint16_t index) const noexcept;
+    uint16_t readSequence(uint16_t index) const noexcept;
+
+    template <typename U>
+    bool queueWrite(uint16_t address, const U& data) noexcept;
+
+    /** EEPROM stream to store the records in. */
+    Interface& myEeprom;
+
+    /** Start address of the EEPROM region. */
+    const uint16_t myStartAddress;
+
+    /** The number of records in the EEPROM region. */
+    const uint16_t myRecordCount;
+
+    /** Index of the latest record. */
+    uint16_t myIndex;
+
+    /** Sequence number of the latest record. */
+    uint16_t mySequence;
+
+    /** Indicate whether the latest record has been located. */
+    bool myRestored;
+
+    /** Indicate whether the slot is empty. */
+    bool myEmpty;
+};
+} // namespace eeprom
+} // namespace driver
+
+#include "impl/slot_impl.h"
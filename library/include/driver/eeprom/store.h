@@ -0,0 +1,274 @@
+/**
+ * @brief Key-value configuration store on EEPROM.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/eeprom/interface.h"
+#include "utils/type_traits.h"
+
+namespace driver 
+{
+namespace eeprom
+{
+/**
+ * @brief Key-value configuration store on EEPROM.
+ * 
+ *        Values of variable length are stored under small integer keys. The EEPROM region is
+ *        split into two banks, of which one is active at a time. Each bank starts with a 16-bit 
+ *        generation number, followed by a log of records of the form [key][length][data]. 
+ *        The log ends at the first erased key byte (0xFF).
+ * 
+ *        The active bank is scanned once at startup to build an index of the record addresses 
+ *        in RAM, so lookups don't require any scans. Values of unchanged length are updated in 
+ *        place, other values are appended to the log and their previous record is marked dead. 
+ *        Dead records are reclaimed by incremental compaction, which copies one live record per 
+ *        step to the other bank and switches banks once all records are copied. Values written 
+ *        or removed during compaction are also updated in the other bank if already copied.
+ * 
+ *        New records are committed by writing their key last, so an interrupted append leaves 
+ *        the store intact. In-place updates of multi-byte values are not atomic.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam KeyCount The number of keys, i.e. keys 0 - (KeyCount - 1) are supported.
+ */
+template <uint8_t KeyCount>
+class Store
+{
+public:
+    // Generate a compiler error if the key count is invalid.
+    static_assert((0U < KeyCount) && (KeyCount <= 254U), 
+        "EEPROM store key count must be between 1 - 254!");
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] eeprom EEPROM stream to store the records in.
+     * @param[in] startAddress Start address of the EEPROM region.
+     * @param[in] regionSize Size of the EEPROM region in bytes, shared equally by both banks.
+     */
+    explicit Store(Interface& eeprom, uint16_t startAddress, uint16_t regionSize) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Store() noexcept = default;
+
+    /**
+     * @brief Check whether the store is initialized.
+     * 
+     * @return True if the store is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept;
+
+    /**
+     * @brief Check whether the store is restored, i.e. the index has been loaded.
+     * 
+     * @return True if the store is restored, false otherwise.
+     */
+    bool isRestored() const noexcept;
+
+    /**
+     * @brief Load the index by scanning the active bank. An empty store is formatted.
+     * 
+     *        The EEPROM stream must be enabled.
+     * 
+     * @return True if the store was restored, false otherwise.
+     */
+    bool restore() noexcept;
+
+    /**
+     * @brief Check whether a value is stored under the given key.
+     * 
+     * @param[in] key The key to check.
+     * 
+     * @return True if a value is stored under the given key, false otherwise.
+     */
+    bool contains(uint8_t key) const noexcept;
+
+    /**
+     * @brief Get the length of the value stored under the given key.
+     * 
+     * @param[in] key The key of the value.
+     * 
+     * @return The length of the value in bytes, or 0 if no value is stored.
+     */
+    uint8_t length(uint8_t key) const noexcept;
+
+    /**
+     * @brief Read the value stored under the given key.
+     * 
+     * @param[in] key The key of the value.
+     * @param[out] data Pointer to buffer for storing the value.
+     * @param[in] size The size of the value in bytes. Must match the stored length.
+     * 
+     * @return True if the value was read, false otherwise.
+     */
+    bool readBlock(uint8_t key, void* data, uint8_t size) const noexcept;
+
+    /**
+     * @brief Write value under the given key.
+     * 
+     *        Values of unchanged length are updated in place, skipping unchanged bytes.
+     *        An ongoing compaction continues, a value already copied is copied again.
+     * 
+     * @param[in] key The key of the value.
+     * @param[in] data Pointer to the value to write.
+     * @param[in] size The size of the value in bytes.
+     * 
+     * @return True if the value was written, false otherwise (e.g. if the active bank is full, 
+     *         in which case the store must be compacted).
+     */
+    bool writeBlock(uint8_t key, const void* data, uint8_t size) noexcept;
+
+    /**
+     * @brief Read the value stored under the given key.
+     * 
+     * @tparam T The value type. Must be trivially copyable.
+     * 
+     * @param[in] key The key of the value.
+     * @param[out] value Reference to variable for storing the value.
+     * 
+     * @return True if the value was read, false otherwise.
+     */
+    template <typename T>
+    bool read(uint8_t key, T& value) const noexcept;
+
+    /**
+     * @brief Write value under the given key.
+     * 
+     * @tparam T The value type. Must be trivially copyable.
+     * 
+     * @param[in] key The key of the value.
+     * @param[in] value The value to write.
+     * 
+     * @return True if the value was written, false otherwise.
+     */
+    template <typename T>
+    bool write(uint8_t key, const T& value) noexcept;
+
+    /**
+     * @brief Remove the value stored under the given key. 
+     * 
+     *        An ongoing compaction continues, a value already copied is removed from the copy.
+     * 
+     * @param[in] key The key of the value.
+     * 
+     * @return True if the value was removed, false if no value was stored.
+     */
+    bool remove(uint8_t key) noexcept;
+
+    /**
+     * @brief Get the number of free bytes in the active bank.
+     * 
+     * @return The number of free bytes.
+     */
+    uint16_t freeSpace() const noexcept;
+
+    /**
+     * @brief Get the number of bytes held by dead records in the active bank.
+     * 
+     * @return The number of bytes held by dead records.
+     */
+    uint16_t deadSpace() const noexcept;
+
+    /**
+     * @brief Check whether a compaction is ongoing.
+     * 
+     * @return True if a compaction is ongoing, false otherwise.
+     */
+    bool isCompacting() const noexcept;
+
+    /**
+     * @brief Perform one compaction step, which copies at most one record.
+     * 
+     *        A compaction is started if the active bank contains dead records.
+     * 
+     * @return True if the compaction is ongoing, false once the store is compact.
+     */
+    bool compactStep() noexcept;
+
+    Store()                        = delete; // No default constructor.
+    Store(const Store&)            = delete; // No copy constructor.
+    Store(Store&&)                 = delete; // No move constructor.
+    Store& operator=(const Store&) = delete; // No copy assignment.
+    Store& operator=(Store&&)      = delete; // No move assignment.
+
+private:
+    /** Key byte of free space. */
+    static constexpr uint8_t FreeKey{0xFFU};
+
+    /** Key byte of dead records (can be programmed without erase). */
+    static constexpr uint8_t DeadKey{0x00U};
+
+    /** Generation number of invalid banks. */
+    static constexpr uint16_t InvalidGeneration{0xFFFFU};
+
+    /** Size of the bank header in bytes. */
+    static constexpr uint16_t HeaderSize{sizeof(uint16_t)};
+
+    /** Size of the record header ([key][length]) in bytes. */
+    static constexpr uint16_t RecordHeaderSize{2U};
+
+    /** Address indicating that no value is stored. */
+    static constexpr uint16_t NoRecord{0U};
+
+    static constexpr uint8_t toKeyByte(uint8_t key) noexcept;
+    static constexpr uint16_t nextGeneration(uint16_t generation) noexcept;
+    uint16_t bankStart(uint8_t bank) const noexcept;
+    uint16_t bankEnd(uint8_t bank) const noexcept;
+    uint8_t readByte(uint16_t address) const noexcept;
+    bool programByte(uint16_t address, uint8_t data) noexcept;
+    uint16_t recordSize(uint16_t address) const noexcept;
+    bool appendRecord(uint16_t& end, uint8_t bank, uint8_t key, 
+                      const void* data, uint8_t size) noexcept;
+    bool copyRecord(uint16_t source, uint16_t destination) noexcept;
+    void killRecord(uint16_t address) noexcept;
+    void scan() noexcept;
+    bool appendCopy(uint16_t source) noexcept;
+    uint16_t findCopy(uint8_t key) const noexcept;
+    void updateCopy(uint8_t key) noexcept;
+    void cancelCompaction() noexcept;
+
+    /** EEPROM stream to store the records in. */
+    Interface& myEeprom;
+
+    /** Start address of the EEPROM region. */
+    const uint16_t myStartAddress;
+
+    /** Size of each bank in bytes. */
+    const uint16_t myBankSize;
+
+    /** Record address of each key (0 = no value stored). */
+    uint16_t myIndex[KeyCount];
+
+    /** Generation number of the active bank. */
+    uint16_t myGeneration;
+
+    /** Address after the last record of the active bank. */
+    uint16_t myEnd;
+
+    /** The number of bytes held by dead records in the active bank. */
+    uint16_t myDeadSpace;
+
+    /** Address after the last record copied during compaction. */
+    uint16_t myCompactEnd;
+
+    /** Index of the active bank (0 or 1). */
+    uint8_t myBank;
+
+    /** Next key to copy during compaction. */
+    uint8_t myCompactKey;
+
+    /** Indicate whether the index has been loaded. */
+    bool myRestored;
+
+    /** Indicate whether a compaction is ongoing. */
+    bool myCompacting;
+};
+} // namespace eeprom
+} // namespace driver
+
+#include "impl/store_impl.h"
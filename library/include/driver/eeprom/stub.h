@@ -30,6 +30,7 @@ public:
      */
     Stub() noexcept
         : myMemory{}
+        , myWriteCount{}
         , myEnabled{true}
     {}
 
@@ -66,6 +67,27 @@ public:
      */
     void setEnabled(const bool enable) noexcept override { myEnabled = enable; }
 
+    /**
+     * @brief Block until all queued writes are complete.
+     * 
+     *        No-op: queued writes are completed immediately.
+     */
+    void flush() noexcept override {}
+
+    /**
+     * @brief Get the number of bytes queued for writing.
+     * 
+     * @return The number of bytes queued for writing (always 0).
+     */
+    uint16_t pendingWrites() const noexcept override { return 0U; }
+
+    /**
+     * @brief Get the number of bytes programmed since the stub was created.
+     * 
+     * @return The number of programmed bytes.
+     */
+    uint16_t writeCount() const noexcept { return myWriteCount; }
+
     /**
      * @brief Check whether the given address is valid.
      * 
@@ -74,9 +96,10 @@ public:
      * 
      * @return True if the address is valid, false otherwise.
      */
-    bool isAddressValid(const uint16_t address, const uint8_t dataSize) const noexcept override
+    bool isAddressValid(const uint16_t address, const uint16_t dataSize) const noexcept override
     {
-        return MemSize > (address + dataSize); 
+        // Compare against the remaining size, since the end address may wrap around in 16 bits.
+        return (MemSize > address) && (MemSize - address >= dataSize);
     }
 
     /**
@@ -84,10 +107,15 @@ public:
      * 
      * @param[in] address Destination address.
      * @param[in] data Data to write.
+     * @param[in] erase True to erase the byte before writing, false to only clear bits.
      */
-    void writeByte(const uint16_t address, const uint8_t data) noexcept override
+    void writeByte(const uint16_t address, const uint8_t data, const bool erase) noexcept override
     {
-        if (myEnabled && (MemSize > address)) { myMemory[address] = data; }
+        if (myEnabled && (MemSize > address)) 
+        { 
+            myMemory[address] = erase ? data : myMemory[address] & data;
+            myWriteCount++;
+        }
     }
 
     /**
@@ -102,6 +130,57 @@ public:
         return myEnabled && (MemSize > address) ? myMemory[address] : 0U;
     }
 
+    /**
+     * @brief Write byte in EEPROM from interrupt context.
+     * 
+     *        Writes are never queued, so the byte is written directly.
+     * 
+     * @param[in] address Destination address.
+     * @param[in] data Data to write.
+     * @param[in] erase True to erase the byte before writing, false to only clear bits.
+     */
+    void writeByteFromIsr(const uint16_t address, const uint8_t data, 
+                          const bool erase) noexcept override
+    {
+        writeByte(address, data, erase);
+    }
+
+    /**
+     * @brief Read byte in EEPROM from interrupt context.
+     * 
+     * @param[in] address The address to read from.
+     * 
+     * @return The data at the given address.
+     */
+    uint8_t readByteFromIsr(const uint16_t address) const noexcept override
+    {
+        return readByte(address);
+    }
+
+    /**
+     * @brief Queue bytes to write in EEPROM. 
+     * 
+     *        The bytes are written immediately, then the callback is invoked.
+     * 
+     * @param[in] address Destination address of the first byte.
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The number of bytes to write.
+     * @param[in] callback Callback to invoke once all bytes have been written (nullptr = none).
+     * 
+     * @return True if the data was written, false otherwise.
+     */
+    bool enqueue(const uint16_t address, const uint8_t* data, const uint8_t size, 
+                 void (*callback)()) noexcept override
+    {
+        // Check the input parameters, return false if invalid.
+        if ((nullptr == data) || (0U == size)) { return false; }
+
+        // Write each byte, then invoke the callback (if any).
+        for (uint8_t i{}; i < size; ++i) { writeByte(address + i, data[i], true); }
+        if (nullptr != callback) { callback(); }
+        return true;
+    }
+
     Stub(const Stub&)            = delete; // No copy constructor.
     Stub(Stub&&)                 = delete; // No move constructor.
     Stub& operator=(const Stub&) = delete; // No copy assignment.
@@ -111,6 +190,9 @@ private:
     /** EEPROM memory. */
     uint8_t myMemory[MemSize]{};
 
+    /** The number of programmed bytes. */
+    uint16_t myWriteCount;
+
     /** Indicate whether the EEPROM stream is enabled. */
     bool myEnabled;
 };
@@ -1 +1,122 @@
-//! @todo Add GPIO driver stub here!
+/**
+ * @brief GPIO driver stub.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/gpio/interface.h"
+
+namespace driver
+{
+namespace gpio
+{
+/**
+ * @brief GPIO driver stub.
+ *
+ *        The stub simulates a single pin on its own I/O port, so enabling pin change interrupt 
+ *        for the port also enables it for the pin.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Stub final : public Interface
+{
+public:
+    /**
+     * @brief Create a new GPIO stub.
+     *
+     * @param[in] direction Data direction of the GPIO (default = output).
+     */
+    explicit Stub(const Direction direction = Direction::Output) noexcept
+        : myDirection{direction}
+        , myInitialized{Direction::Count > direction}
+        , myValue{false}
+        , myInterruptEnabled{false}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stub() noexcept override = default;
+
+    /**
+     * @brief Check if the GPIO is initialized.
+     *
+     * @return True if the GPIO is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override { return myInitialized; }
+
+    /**
+     * @brief Get the data direction of the GPIO.
+     *
+     * @return The data direction of the GPIO.
+     */
+    Direction direction() const noexcept override { return myDirection; }
+
+    /**
+     * @brief Read input of the GPIO.
+     *
+     * @return True if the input is high, false otherwise.
+     */
+    bool read() const noexcept override { return myValue; }
+
+    /**
+     * @brief Write output to the GPIO. The output is also used as simulated input.
+     *
+     * @param[in] output The output value to write (true = high, false = low).
+     */
+    void write(const bool output) noexcept override { myValue = output; }
+
+    /**
+     * @brief Toggle the output of the GPIO.
+     */
+    void toggle() noexcept override { myValue = !myValue; }
+
+    /**
+     * @brief Enable/disable pin change interrupt for the GPIO.
+     *
+     * @param[in] enable True to enable pin change interrupt for the GPIO, false otherwise.
+     */
+    void enableInterrupt(const bool enable) noexcept override { myInterruptEnabled = enable; }
+
+    /**
+     * @brief Enable pin change interrupt for I/O port associated with the GPIO.
+     *
+     * @param[in] enable True to enable pin change interrupt for the I/O port, false otherwise.
+     */
+    void enableInterruptOnPort(const bool enable) noexcept override { myInterruptEnabled = enable; }
+
+    /**
+     * @brief Check whether pin change interrupt is enabled for the GPIO.
+     *
+     * @return True if pin change interrupt is enabled, false otherwise.
+     */
+    bool isInterruptEnabled() const noexcept { return myInterruptEnabled; }
+
+    /**
+     * @brief Set initialization state of the GPIO.
+     *
+     * @param[in] initialized The new initialization state.
+     */
+    void setInitialized(const bool initialized) noexcept { myInitialized = initialized; }
+
+    Stub(const Stub&)            = delete; // No copy constructor.
+    Stub(Stub&&)                 = delete; // No move constructor.
+    Stub& operator=(const Stub&) = delete; // No copy assignment.
+    Stub& operator=(Stub&&)      = delete; // No move assignment.
+
+private:
+    /** Data direction of the GPIO. */
+    const Direction myDirection;
+
+    /** Indicate whether the GPIO is initialized. */
+    bool myInitialized;
+
+    /** The simulated input/output value. */
+    bool myValue;
+
+    /** Indicate whether pin change interrupt is enabled for the GPIO. */
+    bool myInterruptEnabled;
+};
+} // namespace gpio
+} // namespace driver
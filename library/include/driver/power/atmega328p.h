@@ -0,0 +1,97 @@
+/**
+ * @brief Power management driver for ATmega328P.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/power/interface.h"
+
+namespace driver 
+{
+namespace power
+{
+/**
+ * @brief Power management driver for ATmega328P.
+ * 
+ *        Use the singleton design pattern to ensure only one power management instance exists,
+ *        reflecting the hardware limitation of a single sleep mode control register and power
+ *        reduction register on the MCU.
+ * 
+ *        The default sleep mode is idle, since the hardware timers are clocked by the I/O clock,
+ *        which is stopped in all other sleep modes.
+ */
+class Atmega328p final : public Interface
+{
+public:
+    /**
+     * @brief Get the singleton power management instance.
+     * 
+     * @return Reference to the singleton power management instance.
+     */
+    static Interface& getInstance() noexcept;
+
+    /**
+     * @brief Check whether the power management is initialized.
+     * 
+     * @return True if the power management is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Get the sleep mode.
+     * 
+     * @return The sleep mode entered on sleep.
+     */
+    SleepMode sleepMode() const noexcept override;
+
+    /**
+     * @brief Set the sleep mode.
+     * 
+     * @param[in] mode The sleep mode to enter on sleep.
+     * 
+     * @return True if the sleep mode was set, false if the given sleep mode is invalid.
+     */
+    bool setSleepMode(SleepMode mode) noexcept override;
+
+    /**
+     * @brief Put the CPU to sleep until the next interrupt occurs.
+     * 
+     *        Interrupts are enabled right before entering sleep, so the caller may disable 
+     *        interrupts while checking for pending work without missing a wake-up.
+     */
+    void sleep() noexcept override;
+
+    /**
+     * @brief Check whether a peripheral is enabled.
+     * 
+     * @param[in] peripheral The peripheral to check.
+     * 
+     * @return True if the peripheral is enabled, false if it's shut off.
+     */
+    bool isPeripheralEnabled(Peripheral peripheral) const noexcept override;
+
+    /**
+     * @brief Set enablement of a peripheral.
+     * 
+     * @param[in] peripheral The peripheral in question.
+     * @param[in] enable True to enable the peripheral, false to shut it off.
+     * 
+     * @return True if the enablement was updated, false if the given peripheral is invalid.
+     */
+    bool setPeripheralEnabled(Peripheral peripheral, bool enable) noexcept override;
+
+    Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
+    Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
+    Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
+    Atmega328p& operator=(Atmega328p&&)      = delete; // No move assignment.
+
+private:
+    Atmega328p() noexcept;
+    ~Atmega328p() noexcept override = default;
+
+    /** Sleep mode entered on sleep. */
+    SleepMode mySleepMode;
+};
+} // namespace power
+} // namespace driver
@@ -0,0 +1,106 @@
+/**
+ * @brief Power management interface.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace power
+{
+/**
+ * @brief Enumeration of sleep modes.
+ */
+enum class SleepMode : uint8_t
+{
+    Idle,              // Stop the CPU, all peripherals and interrupts keep running.
+    AdcNoiseReduction, // Stop the CPU and the I/O clock, the ADC and Timer 2 keep running.
+    PowerDown,         // Stop all clocks, only external interrupts and the watchdog wake up.
+    PowerSave,         // Power-down mode with Timer 2 running asynchronously.
+    Standby,           // Power-down mode with the oscillator running for a fast wake-up.
+    ExtendedStandby,   // Power-save mode with the oscillator running for a fast wake-up.
+    Count,             // Number of supported sleep modes.
+};
+
+/**
+ * @brief Enumeration of peripherals, which can be shut off to reduce power consumption.
+ */
+enum class Peripheral : uint8_t
+{
+    Adc,    // ADC (A/D converter).
+    Usart0, // USART 0 (serial device).
+    Spi,    // SPI (Serial Peripheral Interface).
+    Timer0, // Timer 0.
+    Timer1, // Timer 1.
+    Timer2, // Timer 2.
+    Twi,    // TWI (Two-Wire Interface).
+    Count,  // Number of supported peripherals.
+};
+
+/**
+ * @brief Power management interface.
+ */
+class Interface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Interface() noexcept = default;
+
+    /**
+     * @brief Check whether the power management is initialized.
+     * 
+     * @return True if the power management is initialized, false otherwise.
+     */
+    virtual bool isInitialized() const noexcept = 0;
+
+    /**
+     * @brief Get the sleep mode.
+     * 
+     * @return The sleep mode entered on sleep.
+     */
+    virtual SleepMode sleepMode() const noexcept = 0;
+
+    /**
+     * @brief Set the sleep mode.
+     * 
+     * @param[in] mode The sleep mode to enter on sleep.
+     * 
+     * @return True if the sleep mode was set, false if the given sleep mode is invalid.
+     */
+    virtual bool setSleepMode(SleepMode mode) noexcept = 0;
+
+    /**
+     * @brief Put the CPU to sleep until the next interrupt occurs.
+     * 
+     *        Interrupts are enabled right before entering sleep, so the caller may disable 
+     *        interrupts while checking for pending work without missing a wake-up.
+     */
+    virtual void sleep() noexcept = 0;
+
+    /**
+     * @brief Check whether a peripheral is enabled.
+     * 
+     * @param[in] peripheral The peripheral to check.
+     * 
+     * @return True if the peripheral is enabled, false if it's shut off.
+     */
+    virtual bool isPeripheralEnabled(Peripheral peripheral) const noexcept = 0;
+
+    /**
+     * @brief Set enablement of a peripheral.
+     * 
+     *        Shut off peripherals the system doesn't use to reduce the active current.
+     *        A peripheral must be disabled by its driver before being shut off.
+     * 
+     * @param[in] peripheral The peripheral in question.
+     * @param[in] enable True to enable the peripheral, false to shut it off.
+     * 
+     * @return True if the enablement was updated, false if the given peripheral is invalid.
+     */
+    virtual bool setPeripheralEnabled(Peripheral peripheral, bool enable) noexcept = 0;
+};
+} // namespace power
+} // namespace driver
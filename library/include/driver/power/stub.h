@@ -0,0 +1,122 @@
+/**
+ * @brief Power management stub.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/power/interface.h"
+
+namespace driver 
+{
+namespace power
+{
+/**
+ * @brief Power management stub.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Stub final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    Stub() noexcept
+        : mySleepMode{SleepMode::Idle}
+        , mySleepCount{}
+        , myDisabledPeripherals{}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stub() noexcept override = default;
+
+    /**
+     * @brief Check whether the power management is initialized.
+     * 
+     * @return True if the power management is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override { return true; }
+
+    /**
+     * @brief Get the sleep mode.
+     * 
+     * @return The sleep mode entered on sleep.
+     */
+    SleepMode sleepMode() const noexcept override { return mySleepMode; }
+
+    /**
+     * @brief Set the sleep mode.
+     * 
+     * @param[in] mode The sleep mode to enter on sleep.
+     * 
+     * @return True if the sleep mode was set, false if the given sleep mode is invalid.
+     */
+    bool setSleepMode(const SleepMode mode) noexcept override
+    {
+        if (SleepMode::Count <= mode) { return false; }
+        mySleepMode = mode;
+        return true;
+    }
+
+    /**
+     * @brief Simulate sleep, which returns immediately.
+     */
+    void sleep() noexcept override { mySleepCount++; }
+
+    /**
+     * @brief Get the number of times the CPU has been put to sleep since the stub was created.
+     * 
+     * @return The number of sleeps.
+     */
+    uint32_t sleepCount() const noexcept { return mySleepCount; }
+
+    /**
+     * @brief Check whether a peripheral is enabled.
+     * 
+     * @param[in] peripheral The peripheral to check.
+     * 
+     * @return True if the peripheral is enabled, false if it's shut off.
+     */
+    bool isPeripheralEnabled(const Peripheral peripheral) const noexcept override
+    {
+        return (Peripheral::Count > peripheral) 
+            && !(myDisabledPeripherals & (1U << static_cast<uint8_t>(peripheral)));
+    }
+
+    /**
+     * @brief Set enablement of a peripheral.
+     * 
+     * @param[in] peripheral The peripheral in question.
+     * @param[in] enable True to enable the peripheral, false to shut it off.
+     * 
+     * @return True if the enablement was updated, false if the given peripheral is invalid.
+     */
+    bool setPeripheralEnabled(const Peripheral peripheral, const bool enable) noexcept override
+    {
+        if (Peripheral::Count <= peripheral) { return false; }
+        const uint8_t mask{static_cast<uint8_t>(1U << static_cast<uint8_t>(peripheral))};
+        if (enable) { myDisabledPeripherals &= ~mask; }
+        else { myDisabledPeripherals |= mask; }
+        return true;
+    }
+
+    Stub(const Stub&)            = delete; // No copy constructor.
+    Stub(Stub&&)                 = delete; // No move constructor.
+    Stub& operator=(const Stub&) = delete; // No copy assignment.
+    Stub& operator=(Stub&&)      = delete; // No move assignment.
+
+private:
+    /** Sleep mode entered on sleep. */
+    SleepMode mySleepMode;
+
+    /** The number of sleeps. */
+    uint32_t mySleepCount;
+
+    /** Mask holding one bit per shut off peripheral. */
+    uint8_t myDisabledPeripherals;
+};
+} // namespace power
+} // namespace driver
@@ -0,0 +1,167 @@
+/**
+ * @brief Change detector for temperature sensors.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace tempsensor
+{
+/** Temperature sensor interface. */
+class Interface;
+
+/**
+ * @brief Change detector for temperature sensors.
+ * 
+ *        The detector samples a temperature sensor and decides whether the latest sample 
+ *        should be reported, so that stable readings don't generate any traffic while changes 
+ *        are reported as soon as they are sampled. A report is triggered by:
+ *            - The first sample.
+ *            - A change from the last reported temperature exceeding the deadband. A change in 
+ *              the opposite direction of the last reported change must exceed the deadband 
+ *              by the hysteresis, which suppresses reports toggling on sensor noise.
+ *            - A change between consecutive samples reaching the rate limit.
+ *            - No report during the maximal silence interval.
+ * 
+ *        A triggered report stays pending until acknowledged, which makes the latest sample 
+ *        the reference for the following changes.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class ChangeDetector final
+{
+public:
+    /**
+     * @brief Structure of report triggers.
+     */
+    struct Trigger
+    {
+        /** No report triggered. */
+        static constexpr uint8_t None{0U};
+
+        /** First sample. */
+        static constexpr uint8_t Initial{1U};
+
+        /** Change from the last report exceeding the deadband. */
+        static constexpr uint8_t Deadband{2U};
+
+        /** Change between consecutive samples reaching the rate limit. */
+        static constexpr uint8_t Rate{3U};
+
+        /** Maximal silence interval elapsed. */
+        static constexpr uint8_t Silence{4U};
+    };
+
+    /**
+     * @brief Structure of detector configuration.
+     */
+    struct Config
+    {
+        /** Maximal change in degrees Celsius from the last report without triggering a report. */
+        uint8_t deadband{1U};
+
+        /** Additional change in degrees Celsius required when the change reverses direction. */
+        uint8_t hysteresis{1U};
+
+        /** Change in degrees Celsius between consecutive samples triggering a report (0 = off). */
+        uint8_t rateLimit{0U};
+
+        /** Maximal number of samples between reports (0 = off). */
+        uint16_t maxSilence{0U};
+    };
+
+    /**
+     * @brief Constructor.
+     * 
+     *        The detector uses a deadband and a hysteresis of 1 degree Celsius without rate 
+     *        limit and silence interval until configured.
+     */
+    ChangeDetector() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ChangeDetector() noexcept = default;
+
+    /**
+     * @brief Set the detector configuration.
+     * 
+     * @param[in] config The new detector configuration.
+     */
+    void setConfig(const Config& config) noexcept { myConfig = config; }
+
+    /**
+     * @brief Sample the given temperature sensor and check whether a report is triggered.
+     * 
+     * @param[in] sensor The temperature sensor to sample.
+     * 
+     * @return The trigger of the sample, or Trigger::None if no report is triggered.
+     */
+    uint8_t update(const Interface& sensor) noexcept;
+
+    /**
+     * @brief Get the latest sample.
+     * 
+     * @return The latest sampled temperature in degrees Celsius.
+     */
+    int16_t temperature() const noexcept { return myTemperature; }
+
+    /**
+     * @brief Get the last reported temperature.
+     * 
+     * @return The last reported temperature in degrees Celsius.
+     */
+    int16_t reported() const noexcept { return myReported; }
+
+    /**
+     * @brief Get the pending report trigger.
+     * 
+     * @return The first trigger since the last acknowledged report, or Trigger::None if no 
+     *         report is pending.
+     */
+    uint8_t pending() const noexcept { return myPending; }
+
+    /**
+     * @brief Acknowledge that the latest sample has been reported.
+     */
+    void acknowledge() noexcept;
+
+    ChangeDetector(const ChangeDetector&)            = delete; // No copy constructor.
+    ChangeDetector(ChangeDetector&&)                 = delete; // No move constructor.
+    ChangeDetector& operator=(const ChangeDetector&) = delete; // No copy assignment.
+    ChangeDetector& operator=(ChangeDetector&&)      = delete; // No move assignment.
+
+private:
+    uint8_t check() const noexcept;
+
+    /** The detector configuration. */
+    Config myConfig;
+
+    /** The latest sampled temperature. */
+    int16_t myTemperature;
+
+    /** The previous sampled temperature. */
+    int16_t myPrevious;
+
+    /** The last reported temperature. */
+    int16_t myReported;
+
+    /** The number of samples since the last report. */
+    uint16_t mySilence;
+
+    /** Direction of the last reported change (-1 = falling, 0 = none, 1 = rising). */
+    int8_t myDirection;
+
+    /** The first trigger since the last acknowledged report. */
+    uint8_t myPending;
+
+    /** Indicate whether any sample has been taken. */
+    bool mySampled;
+
+    /** Indicate whether any sample has been reported. */
+    bool myHasReported;
+};
+} // namespace tempsensor
+} // namespace driver
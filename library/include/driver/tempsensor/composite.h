@@ -0,0 +1,192 @@
+/**
+ * @brief Composite temperature sensor fusing the readings of redundant sensors.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/tempsensor/interface.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+/**
+ * @brief Enumeration of fusion methods.
+ */
+enum class Fusion : uint8_t
+{
+    Median,      // Median of the accepted readings.
+    TrimmedMean, // Mean of the accepted readings, the lowest and highest readings excluded.
+    Weighted,    // Weighted mean of the accepted readings.
+};
+
+/**
+ * @brief Enumeration of sensor health states.
+ */
+enum class Health : uint8_t
+{
+    Ok,             // The reading was accepted.
+    NotInitialized, // The sensor isn't initialized, so it wasn't read.
+    Outlier,        // The reading was rejected as an outlier.
+};
+
+/**
+ * @brief Composite temperature sensor fusing the readings of redundant sensors.
+ *
+ *        Each read samples every initialized sensor once and fuses the readings into one
+ *        estimate. Readings deviating from the median by more than the outlier threshold are
+ *        rejected, given that at least three readings are available (with fewer readings, the
+ *        faulty one can't be told apart). The health of each sensor is updated on each read.
+ *
+ *        The composite only holds references to the sensors, which must outlive the composite.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam Count The number of sensors. Must be greater than 0.
+ */
+template <uint8_t Count>
+class Composite final : public Interface
+{
+    // Generate a compiler error if the composite is empty.
+    static_assert(0U < Count, "Composite sensor must contain at least one sensor!");
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     *        The readings are fused by median without outlier rejection until configured.
+     *
+     * @tparam Sensors The sensor types. Must match the number of sensors.
+     *
+     * @param[in] sensors The sensors to fuse.
+     */
+    template <typename... Sensors>
+    explicit Composite(const Sensors&... sensors) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Composite() noexcept override = default;
+
+    /**
+     * @brief Get the number of sensors.
+     *
+     * @return The number of sensors.
+     */
+    static constexpr uint8_t size() noexcept { return Count; }
+
+    /**
+     * @brief Check if the composite sensor is initialized.
+     *
+     * @return True if at least one of the sensors is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Read the sensors and fuse the accepted readings.
+     *
+     * @return The fused temperature in degrees Celsius, or 0 if no reading was accepted.
+     */
+    int16_t read() const noexcept override;
+
+    /**
+     * @brief Set the fusion method.
+     *
+     * @param[in] fusion The fusion method to use.
+     */
+    void setFusion(Fusion fusion) noexcept { myFusion = fusion; }
+
+    /**
+     * @brief Set the outlier threshold.
+     *
+     * @param[in] threshold Maximal deviation from the median in degrees Celsius (0 = off).
+     */
+    void setOutlierThreshold(uint8_t threshold) noexcept { myOutlierThreshold = threshold; }
+
+    /**
+     * @brief Set the number of readings to exclude at each end for the trimmed mean.
+     *
+     *        The median is used if too few readings remain after trimming.
+     *
+     * @param[in] trimCount The number of lowest and highest readings to exclude.
+     */
+    void setTrimCount(uint8_t trimCount) noexcept { myTrimCount = trimCount; }
+
+    /**
+     * @brief Set the weight of a sensor for weighted fusion.
+     *
+     * @param[in] index Index of the sensor.
+     * @param[in] weight The weight of the sensor (0 = ignore the sensor).
+     *
+     * @return True if the weight was set, false if the index is invalid.
+     */
+    bool setWeight(uint8_t index, uint8_t weight) noexcept;
+
+    /**
+     * @brief Get the health of a sensor at the last read.
+     *
+     * @param[in] index Index of the sensor.
+     *
+     * @return The health of the sensor, Health::NotInitialized if the index is invalid.
+     */
+    Health health(uint8_t index) const noexcept;
+
+    /**
+     * @brief Get the number of accepted readings at the last read.
+     *
+     * @return The number of accepted readings.
+     */
+    uint8_t healthyCount() const noexcept { return myHealthyCount; }
+
+    /**
+     * @brief Get the reading of a sensor at the last read.
+     *
+     * @param[in] index Index of the sensor.
+     *
+     * @return The reading of the sensor in degrees Celsius, 0 if the index is invalid.
+     */
+    int16_t sample(uint8_t index) const noexcept;
+
+    Composite()                            = delete; // No default constructor.
+    Composite(const Composite&)            = delete; // No copy constructor.
+    Composite(Composite&&)                 = delete; // No move constructor.
+    Composite& operator=(const Composite&) = delete; // No copy assignment.
+    Composite& operator=(Composite&&)      = delete; // No move assignment.
+
+private:
+    static void sort(int16_t* values, uint8_t count) noexcept;
+    static int16_t median(const int16_t* sorted, uint8_t count) noexcept;
+    static int16_t divide(int32_t numerator, int32_t denominator) noexcept;
+    uint8_t sampleAll() const noexcept;
+    uint8_t rejectOutliers(int16_t median) const noexcept;
+    int16_t fuse() const noexcept;
+
+    /** The sensors to fuse. */
+    const Interface* const mySensors[Count];
+
+    /** Weight of each sensor for weighted fusion. */
+    uint8_t myWeights[Count];
+
+    /** Reading of each sensor at the last read. */
+    mutable int16_t mySamples[Count];
+
+    /** Health of each sensor at the last read. */
+    mutable Health myHealth[Count];
+
+    /** The number of accepted readings at the last read. */
+    mutable uint8_t myHealthyCount;
+
+    /** Maximal deviation from the median in degrees Celsius (0 = off). */
+    uint8_t myOutlierThreshold;
+
+    /** The number of readings to exclude at each end for the trimmed mean. */
+    uint8_t myTrimCount;
+
+    /** The fusion method. */
+    Fusion myFusion;
+};
+} // namespace tempsensor
+} // namespace driver
+
+#include "impl/composite_impl.h"
@@ -0,0 +1,214 @@
+/**
+ * @brief Implementation details of driver::tempsensor::Composite class.
+ * 
+ * @note Don't include this header, use <composite.h> instead!
+ */
+#pragma once
+
+namespace driver
+{
+namespace tempsensor
+{
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+template <typename... Sensors>
+Composite<Count>::Composite(const Sensors&... sensors) noexcept
+    : mySensors{&sensors...}
+    , myWeights{}
+    , mySamples{}
+    , myHealth{}
+    , myHealthyCount{}
+    , myOutlierThreshold{}
+    , myTrimCount{1U}
+    , myFusion{Fusion::Median}
+{
+    // Generate a compiler error if the number of sensors doesn't match the composite size.
+    static_assert(Count == sizeof...(Sensors), "Sensor count must match the composite size!");
+
+    // Weigh all sensors equally by default.
+    for (auto& weight : myWeights) { weight = 1U; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+bool Composite<Count>::isInitialized() const noexcept
+{
+    for (const auto* sensor : mySensors)
+    {
+        if (sensor->isInitialized()) { return true; }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+int16_t Composite<Count>::read() const noexcept
+{
+    // Sample all sensors in one pass, return 0 if no sensor could be read.
+    const uint8_t sampleCount{sampleAll()};
+    myHealthyCount = sampleCount;
+    if (0U == sampleCount) { return 0; }
+
+    // Reject the outliers if enough readings are available to tell them apart.
+    if ((0U < myOutlierThreshold) && (3U <= sampleCount))
+    {
+        int16_t sorted[Count]{};
+        uint8_t count{};
+
+        for (uint8_t i{}; i < Count; ++i)
+        {
+            if (Health::Ok == myHealth[i]) { sorted[count++] = mySamples[i]; }
+        }
+        sort(sorted, count);
+        myHealthyCount = rejectOutliers(median(sorted, count));
+
+        // Return 0 if all readings were rejected, since they disagree too much.
+        if (0U == myHealthyCount) { return 0; }
+    }
+    return fuse();
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+bool Composite<Count>::setWeight(const uint8_t index, const uint8_t weight) noexcept
+{
+    if (Count <= index) { return false; }
+    myWeights[index] = weight;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+Health Composite<Count>::health(const uint8_t index) const noexcept
+{
+    return Count > index ? myHealth[index] : Health::NotInitialized;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+int16_t Composite<Count>::sample(const uint8_t index) const noexcept
+{
+    return Count > index ? mySamples[index] : 0;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+void Composite<Count>::sort(int16_t* values, const uint8_t count) noexcept
+{
+    // Use insertion sort, which is fast for the small number of sensors.
+    for (uint8_t i{1U}; i < count; ++i)
+    {
+        const int16_t value{values[i]};
+        uint8_t j{i};
+
+        for (; (0U < j) && (values[j - 1U] > value); --j) { values[j] = values[j - 1U]; }
+        values[j] = value;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+int16_t Composite<Count>::median(const int16_t* sorted, const uint8_t count) noexcept
+{
+    // Return 0 if there are no readings. Use the mean of the middle readings if the number of 
+    // readings is even.
+    if (0U == count) { return 0; }
+    const uint8_t middle{static_cast<uint8_t>(count / 2U)};
+    return 0U != (count & 1U) ? sorted[middle]
+        : divide(static_cast<int32_t>(sorted[middle - 1U]) + sorted[middle], 2);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+int16_t Composite<Count>::divide(const int32_t numerator, const int32_t denominator) noexcept
+{
+    // Round to the nearest integer, halfway cases away from zero.
+    const int32_t rounding{denominator / 2};
+    return static_cast<int16_t>(0 <= numerator ? (numerator + rounding) / denominator
+                                               : (numerator - rounding) / denominator);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+uint8_t Composite<Count>::sampleAll() const noexcept
+{
+    // Read each initialized sensor exactly once, return the number of readings.
+    uint8_t count{};
+
+    for (uint8_t i{}; i < Count; ++i)
+    {
+        if (mySensors[i]->isInitialized())
+        {
+            mySamples[i] = mySensors[i]->read();
+            myHealth[i]  = Health::Ok;
+            ++count;
+        }
+        else
+        {
+            mySamples[i] = 0;
+            myHealth[i]  = Health::NotInitialized;
+        }
+    }
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+uint8_t Composite<Count>::rejectOutliers(const int16_t median) const noexcept
+{
+    // Flag the readings deviating too much from the median, return the number of accepted ones.
+    uint8_t count{};
+
+    for (uint8_t i{}; i < Count; ++i)
+    {
+        if (Health::Ok != myHealth[i]) { continue; }
+        const int32_t deviation{static_cast<int32_t>(mySamples[i]) - median};
+
+        if ((myOutlierThreshold < deviation) || (-myOutlierThreshold > deviation))
+        {
+            myHealth[i] = Health::Outlier;
+        }
+        else { ++count; }
+    }
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Count>
+int16_t Composite<Count>::fuse() const noexcept
+{
+    // Collect the accepted readings along with their weights.
+    int16_t sorted[Count]{};
+    int32_t weightedSum{};
+    int32_t weightSum{};
+    uint8_t count{};
+
+    for (uint8_t i{}; i < Count; ++i)
+    {
+        if (Health::Ok != myHealth[i]) { continue; }
+        sorted[count++] = mySamples[i];
+        weightedSum += static_cast<int32_t>(myWeights[i]) * mySamples[i];
+        weightSum   += myWeights[i];
+    }
+
+    // Return 0 if no reading was accepted.
+    if (0U == count) { return 0; }
+
+    // Use the weighted mean if any accepted sensor has a weight.
+    if ((Fusion::Weighted == myFusion) && (0 < weightSum))
+    {
+        return divide(weightedSum, weightSum);
+    }
+    sort(sorted, count);
+
+    // Use the trimmed mean if any reading remains after trimming, otherwise the median.
+    if ((Fusion::TrimmedMean == myFusion) && (2U * myTrimCount < count))
+    {
+        int32_t sum{};
+        for (uint8_t i{myTrimCount}; i < count - myTrimCount; ++i) { sum += sorted[i]; }
+        return divide(sum, count - 2 * myTrimCount);
+    }
+    return median(sorted, count);
+}
+} // namespace tempsensor
+} // namespace driver
@@ -0,0 +1,146 @@
+/**
+ * @brief Temperature sensor smoothed by a scalar Kalman filter.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/tempsensor/interface.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+/**
+ * @brief Temperature sensor smoothed by a scalar Kalman filter.
+ * 
+ *        The filter wraps any temperature sensor and estimates the temperature from its noisy 
+ *        readings, modeling the temperature as a random walk. Each read takes one reading and 
+ *        performs one constant-time filter update with integer math only.
+ * 
+ *        The estimate and the variances are stored in fixed-point format with 8 fractional 
+ *        bits, i.e. the noise variances are given in units of 1/256 squared degrees Celsius.
+ *        A higher process noise makes the filter follow changes faster, a higher measurement 
+ *        noise makes the output smoother.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Kalman final : public Interface
+{
+public:
+    /** The number of fractional bits of the estimate and the variances. */
+    static constexpr uint8_t Shift{8U};
+
+    /** Default process noise variance (0.0625 squared degrees Celsius per reading). */
+    static constexpr uint16_t DefaultProcessNoise{16U};
+
+    /** Default measurement noise variance (1 squared degree Celsius). */
+    static constexpr uint16_t DefaultMeasurementNoise{256U};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] sensor The temperature sensor to smooth.
+     * @param[in] processNoise Process noise variance in fixed-point format 
+     *                         (default = 0.0625 squared degrees Celsius).
+     * @param[in] measurementNoise Measurement noise variance in fixed-point format 
+     *                             (default = 1 squared degree Celsius).
+     */
+    explicit Kalman(const Interface& sensor, uint16_t processNoise = DefaultProcessNoise, 
+                    uint16_t measurementNoise = DefaultMeasurementNoise) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Kalman() noexcept override = default;
+
+    /**
+     * @brief Check if the temperature sensor is initialized.
+     * 
+     * @return True if the wrapped temperature sensor is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Read the temperature sensor and update the estimate.
+     *
+     * @return The estimated temperature in degrees Celsius.
+     */
+    int16_t read() const noexcept override;
+
+    /**
+     * @brief Get the estimated temperature.
+     * 
+     * @return The estimated temperature in fixed-point format.
+     */
+    int32_t estimate() const noexcept { return myEstimate; }
+
+    /**
+     * @brief Get the variance of the estimate.
+     * 
+     * @return The variance of the estimate in fixed-point format.
+     */
+    uint16_t variance() const noexcept { return myVariance; }
+
+    /**
+     * @brief Get the process noise variance.
+     * 
+     * @return The process noise variance in fixed-point format.
+     */
+    uint16_t processNoise() const noexcept { return myProcessNoise; }
+
+    /**
+     * @brief Set the process noise variance.
+     * 
+     * @param[in] noise The process noise variance in fixed-point format.
+     */
+    void setProcessNoise(uint16_t noise) noexcept { myProcessNoise = noise; }
+
+    /**
+     * @brief Get the measurement noise variance.
+     * 
+     * @return The measurement noise variance in fixed-point format.
+     */
+    uint16_t measurementNoise() const noexcept { return myMeasurementNoise; }
+
+    /**
+     * @brief Set the measurement noise variance.
+     * 
+     * @param[in] noise The measurement noise variance in fixed-point format.
+     */
+    void setMeasurementNoise(uint16_t noise) noexcept { myMeasurementNoise = noise; }
+
+    /**
+     * @brief Reset the filter, the next reading initializes the estimate.
+     */
+    void reset() noexcept;
+
+    Kalman()                         = delete; // No default constructor.
+    Kalman(const Kalman&)            = delete; // No copy constructor.
+    Kalman(Kalman&&)                 = delete; // No move constructor.
+    Kalman& operator=(const Kalman&) = delete; // No copy assignment.
+    Kalman& operator=(Kalman&&)      = delete; // No move assignment.
+
+private:
+    void update(int16_t temperature) const noexcept;
+
+    /** The temperature sensor to smooth. */
+    const Interface& mySensor;
+
+    /** The estimated temperature in fixed-point format. */
+    mutable int32_t myEstimate;
+
+    /** The variance of the estimate in fixed-point format. */
+    mutable uint16_t myVariance;
+
+    /** The process noise variance in fixed-point format. */
+    uint16_t myProcessNoise;
+
+    /** The measurement noise variance in fixed-point format. */
+    uint16_t myMeasurementNoise;
+
+    /** Indicate whether the estimate has been initialized. */
+    mutable bool myInitialized;
+};
+} // namespace tempsensor
+} // namespace driver
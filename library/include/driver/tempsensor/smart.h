@@ -1,15 +1,100 @@
-//! @todo Add smart temperature sensor implementation here!
+/**
+ * @brief Smart temperature sensor implementation.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/tempsensor/interface.h"
+
+/** Linear regression interface. */
+namespace ml { namespace lin_reg { class Interface; } }
+
+namespace driver
+{
+/** ADC (A/D converter) interface. */
+namespace adc { class Interface; }
 
+namespace tempsensor
+{
 /**
- * @note Requirements:
+ * @brief Smart temperature sensor implementation.
  * 
- *       1. Prediction: The sensor shall predict temperature based on the input voltage from the 
- *                      associated pin.
- *       2. Voltage Measurement: The input voltage shall be measured using an A/D converter.
- *       3. Model Usage: The sensor shall use a pre-trained linear regression model for temperature 
- *                       prediction.
- *       4. Initialization Prerequisites:
- *           - The associated pin must be a valid ADC channel.
- *           - The ADC must be initialized.
- *           - The linear regression model must be pre-trained.
+ *        The temperature is predicted from the input voltage by a pre-trained linear regression
+ *        model. Since the ADC only yields a small set of codes, the model is evaluated once at
+ *        evenly spaced ADC codes and stored as a piecewise-linear segment table in fixed-point 
+ *        format. Reading the sensor therefore costs one ADC read plus one table lookup.
+ * 
+ *        The table is rebuilt automatically on the next read when the model is retrained.
+ * 
+ *        This class is non-copyable and non-movable.
  */
+class Smart final : public Interface
+{
+public:
+    /** Number of segments in the lookup table. */
+    static constexpr uint8_t SegmentCount{16U};
+
+    /** Maximal supported ADC resolution in bits. */
+    static constexpr uint8_t MaxResolution{10U};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] pin Pin the temperature sensor is connected to.
+     * @param[in] adc A/D converter for reading the input voltage from the sensor.
+     * @param[in] linReg Linear regression model for predicting the temperature.
+     */
+    explicit Smart(uint8_t pin, adc::Interface& adc, const ml::lin_reg::Interface& linReg) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Smart() noexcept override = default;
+
+    /**
+     * @brief Check if the temperature sensor is initialized.
+     * 
+     * @return True if the temperature sensor is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Read the temperature sensor.
+     *
+     * @return The temperature in degrees Celsius.
+     */
+    int16_t read() const noexcept override;
+
+    Smart()                        = delete; // No default constructor.
+    Smart(const Smart&)            = delete; // No copy constructor.
+    Smart(Smart&&)                 = delete; // No move constructor.
+    Smart& operator=(const Smart&) = delete; // No copy assignment.
+    Smart& operator=(Smart&&)      = delete; // No move assignment.
+
+private:
+    void updateTable() const noexcept;
+
+    /** A/D converter to read the input voltage from the sensor. */
+    adc::Interface& myAdc;
+
+    /** Linear regression model used for predicting the temperature. */
+    const ml::lin_reg::Interface& myLinReg;
+
+    /** Predicted temperature at each segment boundary, stored in fixed-point format. */
+    mutable int32_t myTable[SegmentCount + 1U];
+
+    /** Model revision the table was built from. */
+    mutable uint16_t myRevision;
+
+    /** Number of ADC codes per segment, expressed as a power of two. */
+    const uint8_t mySegmentShift;
+
+    /** Analog pin the temperature sensor is connected to. */
+    const uint8_t myPin;
+
+    /** Indicate whether the table has been built. */
+    mutable bool myTableValid;
+};
+} // namespace tempsensor
+} // namespace driver
@@ -1 +1,93 @@
-//! @todo Add temperature sensor stub here!
+/**
+ * @brief Temperature sensor stub.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/tempsensor/interface.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+/**
+ * @brief Temperature sensor stub.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Stub final : public Interface
+{
+public:
+    /**
+     * @brief Create a new temperature sensor stub.
+     *
+     * @param[in] temperature The temperature to read in degrees Celsius (default = 0).
+     */
+    explicit Stub(const int16_t temperature = 0) noexcept
+        : myTemperature{temperature}
+        , myReadCount{}
+        , myInitialized{true}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stub() noexcept override = default;
+
+    /**
+     * @brief Check if the temperature sensor is initialized.
+     *
+     * @return True if the temperature sensor is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override { return myInitialized; }
+
+    /**
+     * @brief Read the temperature sensor.
+     *
+     * @return The temperature in degrees Celsius.
+     */
+    int16_t read() const noexcept override
+    {
+        myReadCount++;
+        return myTemperature;
+    }
+
+    /**
+     * @brief Set the temperature to read.
+     *
+     * @param[in] temperature The new temperature in degrees Celsius.
+     */
+    void setTemperature(const int16_t temperature) noexcept { myTemperature = temperature; }
+
+    /**
+     * @brief Set initialization state of the temperature sensor.
+     *
+     * @param[in] initialized The new initialization state.
+     */
+    void setInitialized(const bool initialized) noexcept { myInitialized = initialized; }
+
+    /**
+     * @brief Get the number of reads of the temperature sensor.
+     *
+     * @return The number of reads.
+     */
+    uint16_t readCount() const noexcept { return myReadCount; }
+
+    Stub(const Stub&)            = delete; // No copy constructor.
+    Stub(Stub&&)                 = delete; // No move constructor.
+    Stub& operator=(const Stub&) = delete; // No copy assignment.
+    Stub& operator=(Stub&&)      = delete; // No move assignment.
+
+private:
+    /** The temperature to read in degrees Celsius. */
+    int16_t myTemperature;
+
+    /** The number of reads, updated on each read. */
+    mutable uint16_t myReadCount;
+
+    /** Indicate whether the temperature sensor is initialized. */
+    bool myInitialized;
+};
+} // namespace tempsensor
+} // namespace driver
@@ -17,6 +17,9 @@ namespace tempsensor
 /**
  * @brief TMP36 temperature sensor implementation.
  * 
+ *        The temperature is calculated with integer math only. The fixed-point gain is derived
+ *        from the supply voltage and the resolution of the ADC when the sensor is created.
+ * 
  *        This class is non-copyable and non-movable.
  */
 class Tmp36 final : public Interface
@@ -59,6 +62,9 @@ private:
     /** A/D converter to read the input voltage from the sensor. */
     adc::Interface& myAdc;
 
+    /** Temperature per ADC step in degrees Celsius, stored in fixed-point format. */
+    const uint32_t myGain;
+
     /** Analog pin the temperature sensor is connected to. */
     const uint8_t myPin;
 };
@@ -1 +1,138 @@
-//! @todo Add timer driver stub here!
+/**
+ * @brief Timer driver stub.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/timer/interface.h"
+
+namespace driver
+{
+namespace timer
+{
+/**
+ * @brief Timer driver stub.
+ *
+ *        Timeouts are simulated via the setTimedOut method.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Stub final : public Interface
+{
+public:
+    /**
+     * @brief Create a new timer stub.
+     *
+     * @param[in] timeout_ms Timeout in milliseconds (default = 100 ms).
+     * @param[in] startTimer True to start the timer immediately (default = false).
+     */
+    explicit Stub(const uint32_t timeout_ms = 100U, const bool startTimer = false) noexcept
+        : myTimeout_ms{timeout_ms}
+        , myInitialized{true}
+        , myEnabled{startTimer}
+        , myTimedOut{false}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~Stub() noexcept override = default;
+
+    /**
+     * @brief Check if the timer is initialized.
+     *
+     * @return True if the timer is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override { return myInitialized; }
+
+    /**
+     * @brief Check whether the timer is enabled.
+     *
+     * @return True if the timer is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override { return myEnabled; }
+
+    /**
+     * @brief Check whether the timer has timed out.
+     *
+     * @return True if the timer is enabled and has timed out, false otherwise.
+     */
+    bool hasTimedOut() const noexcept override { return myEnabled && myTimedOut; }
+
+    /**
+     * @brief Get the timeout of the timer.
+     *
+     * @return The timeout in milliseconds.
+     */
+    uint32_t timeout_ms() const noexcept override { return myTimeout_ms; }
+
+    /**
+     * @brief Set timeout of the timer.
+     *
+     * @param[in] timeout_ms The new timeout in milliseconds.
+     */
+    void setTimeout_ms(const uint32_t timeout_ms) noexcept override { myTimeout_ms = timeout_ms; }
+
+    /**
+     * @brief Start the timer.
+     */
+    void start() noexcept override { myEnabled = true; }
+
+    /**
+     * @brief Stop the timer.
+     */
+    void stop() noexcept override
+    {
+        myEnabled  = false;
+        myTimedOut = false;
+    }
+
+    /**
+     * @brief Toggle the timer.
+     */
+    void toggle() noexcept override { myEnabled ? stop() : start(); }
+
+    /**
+     * @brief Restart the timer.
+     */
+    void restart() noexcept override
+    {
+        myTimedOut = false;
+        myEnabled  = true;
+    }
+
+    /**
+     * @brief Set the timeout state of the timer.
+     *
+     * @param[in] timedOut True to simulate a timeout, false otherwise.
+     */
+    void setTimedOut(const bool timedOut) noexcept { myTimedOut = timedOut; }
+
+    /**
+     * @brief Set initialization state of the timer.
+     *
+     * @param[in] initialized The new initialization state.
+     */
+    void setInitialized(const bool initialized) noexcept { myInitialized = initialized; }
+
+    Stub(const Stub&)            = delete; // No copy constructor.
+    Stub(Stub&&)                 = delete; // No move constructor.
+    Stub& operator=(const Stub&) = delete; // No copy assignment.
+    Stub& operator=(Stub&&)      = delete; // No move assignment.
+
+private:
+    /** Timeout in milliseconds. */
+    uint32_t myTimeout_ms;
+
+    /** Indicate whether the timer is initialized. */
+    bool myInitialized;
+
+    /** Indicate whether the timer is enabled. */
+    bool myEnabled;
+
+    /** Indicate whether the timer has timed out. */
+    bool myTimedOut;
+};
+} // namespace timer
+} // namespace driver
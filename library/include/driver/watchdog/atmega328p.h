@@ -18,6 +18,10 @@ namespace watchdog
  *        reflecting the hardware limitation of a single watchdog on the MCU.
  * 
  *        The default timeout is 1024 ms.
+ * 
+ *        If a timeout callback is set, the watchdog runs in interrupt and system reset mode:
+ *        the callback is invoked from the watchdog interrupt on the first timeout, then the 
+ *        system is reset on the next timeout.
  */
 class Atmega328p final : public Interface
 {
@@ -72,9 +76,22 @@ public:
 
     /**
      * @brief Reset the watchdog timer.
+     * 
+     *        The watchdog interrupt is re-armed if a timeout callback is set, since the interrupt
+     *        is disabled by hardware on each timeout.
      */
     void reset() noexcept override;
 
+    /**
+     * @brief Set callback to invoke on watchdog timeout, right before the system is reset.
+     * 
+     *        The callback is invoked from interrupt context and must complete within one
+     *        watchdog timeout, after which the system is reset.
+     * 
+     * @param[in] callback The callback to invoke (nullptr = reset without callback).
+     */
+    void setTimeoutCallback(void (*callback)()) noexcept override;
+
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
     Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
@@ -61,6 +61,16 @@ public:
      * @brief Reset the watchdog timer.
      */
     virtual void reset() noexcept = 0;
+
+    /**
+     * @brief Set callback to invoke on watchdog timeout, right before the system is reset.
+     * 
+     *        The callback is invoked from interrupt context and must complete within one
+     *        watchdog timeout, after which the system is reset.
+     * 
+     * @param[in] callback The callback to invoke (nullptr = reset without callback).
+     */
+    virtual void setTimeoutCallback(void (*callback)()) noexcept = 0;
 };
 } // namespace watchdog
 } // namespace driver
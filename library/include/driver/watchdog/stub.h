@@ -26,6 +26,9 @@ public:
      */
     Stub(const uint16_t timeout_ms = 1024U) noexcept
         : myTimeout_ms{timeout_ms}
+        , myResetCount{}
+        , myTimeoutCallback{nullptr}
+        , myEnabled{false}
     {}
 
     /**
@@ -78,7 +81,29 @@ public:
     /**
      * @brief Reset the watchdog timer.
      */
-    void reset() noexcept override {}
+    void reset() noexcept override { myResetCount++; }
+
+    /**
+     * @brief Get the number of watchdog resets since the stub was created.
+     * 
+     * @return The number of watchdog resets.
+     */
+    uint32_t resetCount() const noexcept { return myResetCount; }
+
+    /**
+     * @brief Set callback to invoke on watchdog timeout, right before the system is reset.
+     * 
+     * @param[in] callback The callback to invoke (nullptr = reset without callback).
+     */
+    void setTimeoutCallback(void (*callback)()) noexcept override { myTimeoutCallback = callback; }
+
+    /**
+     * @brief Simulate watchdog timeout by invoking the timeout callback (if any).
+     */
+    void simulateTimeout() const noexcept
+    {
+        if (nullptr != myTimeoutCallback) { myTimeoutCallback(); }
+    }
 
     Stub(const Stub&)            = delete; // No copy constructor.
     Stub(Stub&&)                 = delete; // No move constructor.
@@ -89,6 +114,12 @@ private:
     /** Watchdog timeout in ms. */
     uint16_t myTimeout_ms;
 
+    /** The number of watchdog resets. */
+    uint32_t myResetCount;
+
+    /** Callback to invoke on watchdog timeout (nullptr = none). */
+    void (*myTimeoutCallback)();
+
     /** Indicate whether the watchdog is enabled. */
     bool myEnabled;
 };
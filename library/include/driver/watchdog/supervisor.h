@@ -0,0 +1,168 @@
+/**
+ * @brief Task-aware watchdog supervisor.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/watchdog/interface.h"
+
+namespace driver
+{
+namespace watchdog
+{
+/**
+ * @brief Task-aware watchdog supervisor.
+ * 
+ *        The supervisor wraps a watchdog timer and supervises up to eight tasks, each of which
+ *        must check in within its own deadline. Deadlines are counted in supervision ticks, 
+ *        which are generated by calling tick() periodically. Tasks that miss their deadline are
+ *        latched in the expired mask. The underlying watchdog is only reset while no task has 
+ *        expired, which costs a single mask comparison per reset.
+ * 
+ *        Check-ins and ticks may be performed from interrupt context.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Supervisor final : public Interface
+{
+public:
+    /** Maximum number of supervised tasks. */
+    static constexpr uint8_t MaxTaskCount{8U};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] watchdog The watchdog timer to supervise.
+     */
+    explicit Supervisor(Interface& watchdog) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Supervisor() noexcept override = default;
+
+    /**
+     * @brief Check whether the watchdog timer is initialized.
+     * 
+     * @return True if the watchdog timer is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Check whether the watchdog timer is enabled.
+     * 
+     * @return True if the watchdog timer is enabled, false otherwise.
+     */
+    bool isEnabled() const noexcept override;
+
+    /**
+     * @brief Set enablement of the watchdog timer.
+     * 
+     * @param[in] enable True to enable the watchdog timer, false otherwise.
+     */
+    void setEnabled(bool enable) noexcept override;
+
+    /**
+     * @brief Get timeout of the watchdog timer.
+     * 
+     * @return Timeout of the watchdog timer in milliseconds.
+     */
+    uint16_t timeout_ms() const noexcept override;
+
+    /**
+     * @brief Set timeout of the watchdog timer.
+     * 
+     * @param[in] timeout Timeout of the watchdog timer in milliseconds.
+     * 
+     * @return True if the timeout was set, false if the given timeout is invalid.
+     */
+    bool setTimeout_ms(uint16_t timeout_ms) noexcept override;
+
+    /**
+     * @brief Reset the watchdog timer if no supervised task has expired.
+     */
+    void reset() noexcept override;
+
+    /**
+     * @brief Set callback to invoke on watchdog timeout, right before the system is reset.
+     * 
+     * @param[in] callback The callback to invoke (nullptr = reset without callback).
+     */
+    void setTimeoutCallback(void (*callback)()) noexcept override;
+
+    /**
+     * @brief Add task to supervise. The deadline starts counting immediately.
+     * 
+     * @param[in] task The task ID (0 - 7).
+     * @param[in] deadline The number of ticks within which the task must check in. The task
+     *                     expires on the next tick after the deadline has passed.
+     * 
+     * @return True if the task was added, false if the task ID or deadline is invalid.
+     */
+    bool addTask(uint8_t task, uint8_t deadline) noexcept;
+
+    /**
+     * @brief Remove supervised task.
+     * 
+     * @param[in] task The task ID (0 - 7).
+     */
+    void removeTask(uint8_t task) noexcept;
+
+    /**
+     * @brief Check in task, which restarts its deadline.
+     * 
+     * @param[in] task The task ID (0 - 7).
+     */
+    void checkIn(uint8_t task) noexcept;
+
+    /**
+     * @brief Advance the deadlines of all supervised tasks by one tick.
+     */
+    void tick() noexcept;
+
+    /**
+     * @brief Get the mask of supervised tasks.
+     * 
+     * @return Mask with the bits of supervised tasks set.
+     */
+    uint8_t taskMask() const noexcept;
+
+    /**
+     * @brief Get the mask of expired tasks, i.e. tasks that missed their deadline.
+     * 
+     * @return Mask with the bits of expired tasks set.
+     */
+    uint8_t expiredMask() const noexcept;
+
+    /**
+     * @brief Get the first task that missed its deadline.
+     * 
+     * @return The ID of the first expired task, or -1 if no task has expired.
+     */
+    int8_t missedTask() const noexcept;
+
+    Supervisor()                             = delete; // No default constructor.
+    Supervisor(const Supervisor&)            = delete; // No copy constructor.
+    Supervisor(Supervisor&&)                 = delete; // No move constructor.
+    Supervisor& operator=(const Supervisor&) = delete; // No copy assignment.
+    Supervisor& operator=(Supervisor&&)      = delete; // No move assignment.
+
+private:
+    /** The supervised watchdog timer. */
+    Interface& myWatchdog;
+
+    /** Deadline of each task in ticks. */
+    uint8_t myDeadline[MaxTaskCount];
+
+    /** Remaining ticks of each task until its deadline. */
+    volatile uint8_t myRemaining[MaxTaskCount];
+
+    /** Mask of supervised tasks. */
+    volatile uint8_t myTaskMask;
+
+    /** Mask of expired tasks. */
+    volatile uint8_t myExpiredMask;
+};
+} // namespace watchdog
+} // namespace driver
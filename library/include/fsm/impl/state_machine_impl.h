@@ -0,0 +1,201 @@
+/**
+ * @brief Implementation details of fsm::StateMachine class.
+ * 
+ * @note Don't include this header, use <state_machine.h> instead!
+ */
+#pragma once
+
+namespace fsm
+{
+// -----------------------------------------------------------------------------
+template <typename Context, uint8_t StateCount, uint8_t EventCount, uint8_t TransitionCount>
+constexpr bool Table<Context, StateCount, EventCount, TransitionCount>::isValid() const noexcept
+{
+    // Check that each parent exists and that each state reaches the top level without cycles.
+    for (uint8_t state{}; state < StateCount; ++state)
+    {
+        uint8_t depth{};
+
+        for (uint8_t parent{states[state].parent}; None != parent; parent = states[parent].parent)
+        {
+            if ((StateCount <= parent) || (StateCount < ++depth)) { return false; }
+        }
+    }
+
+    // Check that each transition refers to existing states and events.
+    for (uint8_t i{}; i < TransitionCount; ++i)
+    {
+        const Transition<Context>& transition{transitions[i]};
+        if ((StateCount <= transition.source) || (EventCount <= transition.event)) { return false; }
+        if ((None != transition.target) && (StateCount <= transition.target)) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t EventCount, typename Context, uint8_t StateCount, uint8_t TransitionCount>
+constexpr Table<Context, StateCount, EventCount, TransitionCount> 
+    makeTable(const State<Context> (&states)[StateCount], 
+              const Transition<Context> (&transitions)[TransitionCount]) noexcept
+{
+    Table<Context, StateCount, EventCount, TransitionCount> table{};
+
+    for (uint8_t state{}; state < StateCount; ++state) 
+    { 
+        table.states[state] = states[state]; 
+
+        for (uint8_t event{}; event < EventCount; ++event) { table.first[state][event] = None; }
+    }
+
+    // Link the transitions of each (state, event) pair, backwards to preserve the given order.
+    for (uint8_t i{TransitionCount}; 0U < i; --i)
+    {
+        const uint8_t index{static_cast<uint8_t>(i - 1U)};
+        const Transition<Context>& transition{transitions[index]};
+        table.transitions[index] = transition;
+        table.next[index]        = None;
+
+        if ((StateCount > transition.source) && (EventCount > transition.event))
+        {
+            table.next[index] = table.first[transition.source][transition.event];
+            table.first[transition.source][transition.event] = index;
+        }
+    }
+    return table;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+template <uint8_t StateCount, uint8_t EventCount, uint8_t TransitionCount>
+StateMachine<Context>::StateMachine(
+    const Table<Context, StateCount, EventCount, TransitionCount>& table, 
+    Context& context) noexcept
+    : myStates{table.states}
+    , myTransitions{table.transitions}
+    , myFirst{&table.first[0U][0U]}
+    , myNext{table.next}
+    , myContext{context}
+    , myStateCount{StateCount}
+    , myEventCount{EventCount}
+    , myState{None}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+bool StateMachine<Context>::start(const uint8_t state) noexcept
+{
+    if (myStateCount <= state) { return false; }
+    enterFrom(None, state);
+    myState = state;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+bool StateMachine<Context>::isStarted() const noexcept { return None != myState; }
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+uint8_t StateMachine<Context>::state() const noexcept { return myState; }
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+bool StateMachine<Context>::isIn(const uint8_t state) const noexcept
+{
+    for (uint8_t current{myState}; None != current; current = myStates[current].parent)
+    {
+        if (state == current) { return true; }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+bool StateMachine<Context>::dispatch(const uint8_t event) noexcept
+{
+    if (!isStarted() || (myEventCount <= event)) { return false; }
+
+    // Ignore the event if no state handles it.
+    const Transition<Context>* transition{findTransition(event)};
+    if (nullptr == transition) { return false; }
+
+    // Perform internal transitions without changing state.
+    if (None == transition->target)
+    {
+        if (nullptr != transition->action) { transition->action(myContext); }
+        return true;
+    }
+
+    // Exit the states up to the closest common ancestor, which is also exited (and re-entered)
+    // if it's the target itself, i.e. on self-transitions and transitions to an ancestor.
+    uint8_t ancestor{commonAncestor(transition->source, transition->target)};
+    if (transition->target == ancestor) { ancestor = myStates[ancestor].parent; }
+    exitUntil(ancestor);
+
+    // Perform the transition action, then enter the states down to the target.
+    if (nullptr != transition->action) { transition->action(myContext); }
+    enterFrom(ancestor, transition->target);
+    myState = transition->target;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+const Transition<Context>* StateMachine<Context>::findTransition(const uint8_t event) 
+    const noexcept
+{
+    // Look up the first enabled transition of the current state, then of its ancestors.
+    for (uint8_t state{myState}; None != state; state = myStates[state].parent)
+    {
+        for (uint8_t i{myFirst[state * myEventCount + event]}; None != i; i = myNext[i])
+        {
+            const Transition<Context>& transition{myTransitions[i]};
+            if ((nullptr == transition.guard) || transition.guard(myContext)) 
+            { 
+                return &transition; 
+            }
+        }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+uint8_t StateMachine<Context>::commonAncestor(const uint8_t first, const uint8_t second) 
+    const noexcept
+{
+    for (uint8_t x{first}; None != x; x = myStates[x].parent)
+    {
+        for (uint8_t y{second}; None != y; y = myStates[y].parent)
+        {
+            if (x == y) { return x; }
+        }
+    }
+    return None;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+void StateMachine<Context>::exitUntil(const uint8_t ancestor) noexcept
+{
+    // Exit the current state and its ancestors, innermost first.
+    while ((None != myState) && (ancestor != myState))
+    {
+        const State<Context>& state{myStates[myState]};
+        if (nullptr != state.exit) { state.exit(myContext); }
+        myState = state.parent;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context>
+void StateMachine<Context>::enterFrom(const uint8_t ancestor, const uint8_t target) noexcept
+{
+    // Enter the states below the ancestor, outermost first.
+    if ((None == target) || (ancestor == target)) { return; }
+    enterFrom(ancestor, myStates[target].parent);
+
+    const State<Context>& state{myStates[target]};
+    if (nullptr != state.entry) { state.entry(myContext); }
+}
+} // namespace fsm
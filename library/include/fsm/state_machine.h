@@ -0,0 +1,233 @@
+/**
+ * @brief Table-driven hierarchical state machine.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace fsm
+{
+/** Value indicating no state, no transition or an internal transition. */
+constexpr uint8_t None{0xFFU};
+
+/**
+ * @brief Structure holding a state of a state machine.
+ * 
+ * @tparam Context The context type passed to the entry and exit actions.
+ */
+template <typename Context>
+struct State
+{
+    /** ID of the parent state (None = top-level state). */
+    uint8_t parent;
+
+    /** Action to perform on state entry (nullptr = none). */
+    void (*entry)(Context& context);
+
+    /** Action to perform on state exit (nullptr = none). */
+    void (*exit)(Context& context);
+};
+
+/**
+ * @brief Structure holding a transition of a state machine.
+ * 
+ * @tparam Context The context type passed to the guard and the action.
+ */
+template <typename Context>
+struct Transition
+{
+    /** ID of the state handling the event. */
+    uint8_t source;
+
+    /** ID of the event triggering the transition. */
+    uint8_t event;
+
+    /** ID of the target state (None = internal transition, the state is left unchanged). */
+    uint8_t target;
+
+    /** Guard enabling the transition (nullptr = always enabled). */
+    bool (*guard)(Context& context);
+
+    /** Action to perform during the transition (nullptr = none). */
+    void (*action)(Context& context);
+};
+
+/**
+ * @brief Structure holding the compiled tables of a state machine.
+ * 
+ *        Create with makeTable(), preferably as a constexpr object. Dispatch then only requires
+ *        a lookup of the first transition of each (state, event) pair, followed by the 
+ *        alternatives with other guards, if any.
+ * 
+ * @tparam Context         The context type passed to the actions and guards.
+ * @tparam StateCount      The number of states.
+ * @tparam EventCount      The number of events.
+ * @tparam TransitionCount The number of transitions.
+ */
+template <typename Context, uint8_t StateCount, uint8_t EventCount, uint8_t TransitionCount>
+struct Table
+{
+    // Generate a compiler error if the table sizes are invalid.
+    static_assert((0U < StateCount) && (None > StateCount), "Invalid state count!");
+    static_assert((0U < EventCount) && (None > EventCount), "Invalid event count!");
+    static_assert((0U < TransitionCount) && (None > TransitionCount), "Invalid transition count!");
+
+    /** States of the state machine. */
+    State<Context> states[StateCount];
+
+    /** Transitions of the state machine. */
+    Transition<Context> transitions[TransitionCount];
+
+    /** Index of the first transition of each (state, event) pair (None = no transition). */
+    uint8_t first[StateCount][EventCount];
+
+    /** Index of the next transition with the same state and event (None = no transition). */
+    uint8_t next[TransitionCount];
+
+    /**
+     * @brief Check whether the table is valid, i.e. whether all IDs are in range and the state
+     *        hierarchy is free of cycles. Verify with a static assertion.
+     * 
+     * @return True if the table is valid, false otherwise.
+     */
+    constexpr bool isValid() const noexcept;
+};
+
+/**
+ * @brief Compile the tables of a state machine.
+ * 
+ * @tparam EventCount      The number of events.
+ * @tparam Context         The context type passed to the actions and guards.
+ * @tparam StateCount      The number of states.
+ * @tparam TransitionCount The number of transitions.
+ * 
+ * @param[in] states The states of the state machine, indexed by state ID.
+ * @param[in] transitions The transitions of the state machine. Transitions with the same state
+ *                        and event are evaluated in the given order.
+ * 
+ * @return The compiled tables.
+ */
+template <uint8_t EventCount, typename Context, uint8_t StateCount, uint8_t TransitionCount>
+constexpr Table<Context, StateCount, EventCount, TransitionCount> 
+    makeTable(const State<Context> (&states)[StateCount], 
+              const Transition<Context> (&transitions)[TransitionCount]) noexcept;
+
+/**
+ * @brief Table-driven hierarchical state machine.
+ * 
+ *        Events are handled by the current state or, if the current state has no enabled 
+ *        transition for the event, by the closest ancestor that has one. Events no state
+ *        handles are ignored. On a transition, the states are exited up to the closest common
+ *        ancestor of the source and the target, then the transition action is performed, 
+ *        after which the states are entered down to the target.
+ * 
+ *        The state machine refers to its tables, which must outlive the state machine.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam Context The context type passed to the actions and guards.
+ */
+template <typename Context>
+class StateMachine
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @tparam StateCount      The number of states.
+     * @tparam EventCount      The number of events.
+     * @tparam TransitionCount The number of transitions.
+     * 
+     * @param[in] table The compiled tables of the state machine.
+     * @param[in] context The context passed to the actions and guards.
+     */
+    template <uint8_t StateCount, uint8_t EventCount, uint8_t TransitionCount>
+    StateMachine(const Table<Context, StateCount, EventCount, TransitionCount>& table, 
+                 Context& context) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~StateMachine() noexcept = default;
+
+    /**
+     * @brief Start the state machine by entering the given initial state, starting from its
+     *        top-level ancestor.
+     * 
+     * @param[in] state ID of the initial state.
+     * 
+     * @return True if the state machine was started, false if the state ID is invalid.
+     */
+    bool start(uint8_t state) noexcept;
+
+    /**
+     * @brief Check whether the state machine has been started.
+     * 
+     * @return True if the state machine has been started, false otherwise.
+     */
+    bool isStarted() const noexcept;
+
+    /**
+     * @brief Get the current state.
+     * 
+     * @return ID of the current state (None if the state machine hasn't been started).
+     */
+    uint8_t state() const noexcept;
+
+    /**
+     * @brief Check whether the current state is the given state or one of its descendants.
+     * 
+     * @param[in] state ID of the state to check.
+     * 
+     * @return True if the state machine is in the given state, false otherwise.
+     */
+    bool isIn(uint8_t state) const noexcept;
+
+    /**
+     * @brief Dispatch event to the state machine.
+     * 
+     * @param[in] event ID of the event to dispatch.
+     * 
+     * @return True if the event was handled, false if it was ignored.
+     */
+    bool dispatch(uint8_t event) noexcept;
+
+    StateMachine()                               = delete; // No default constructor.
+    StateMachine(const StateMachine&)            = delete; // No copy constructor.
+    StateMachine(StateMachine&&)                 = delete; // No move constructor.
+    StateMachine& operator=(const StateMachine&) = delete; // No copy assignment.
+    StateMachine& operator=(StateMachine&&)      = delete; // No move assignment.
+
+private:
+    const Transition<Context>* findTransition(uint8_t event) const noexcept;
+    uint8_t commonAncestor(uint8_t first, uint8_t second) const noexcept;
+    void exitUntil(uint8_t ancestor) noexcept;
+    void enterFrom(uint8_t ancestor, uint8_t target) noexcept;
+
+    /** States of the state machine. */
+    const State<Context>* myStates;
+
+    /** Transitions of the state machine. */
+    const Transition<Context>* myTransitions;
+
+    /** Index of the first transition of each (state, event) pair. */
+    const uint8_t* myFirst;
+
+    /** Index of the next transition with the same state and event. */
+    const uint8_t* myNext;
+
+    /** The context passed to the actions and guards. */
+    Context& myContext;
+
+    /** The number of states. */
+    const uint8_t myStateCount;
+
+    /** The number of events. */
+    const uint8_t myEventCount;
+
+    /** ID of the current state. */
+    uint8_t myState;
+};
+} // namespace fsm
+
+#include "impl/state_machine_impl.h"
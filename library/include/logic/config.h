@@ -0,0 +1,39 @@
+/**
+ * @brief Compile-time configuration of the logic implementation.
+ * 
+ *        Adjust the device counts to scale the system to more I/O. The devices are passed to 
+ *        the logic implementation as compile-time sized device groups.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace logic
+{
+namespace config
+{
+/** The number of LEDs toggled by the toggle timer. */
+constexpr uint8_t LedCount{1U};
+
+/** The number of buttons toggling the toggle timer. */
+constexpr uint8_t ToggleButtonCount{1U};
+
+/** The number of buttons printing the temperature. */
+constexpr uint8_t TempButtonCount{1U};
+
+/** The number of temperature sensors, each sampled and reported separately. */
+constexpr uint8_t TempSensorCount{1U};
+
+/** Report the temperature on change instead of once per temperature period. */
+constexpr bool TempReportOnChange{true};
+
+/** Maximal temperature change in degrees Celsius from the last report without reporting. */
+constexpr uint8_t TempDeadband{1U};
+
+/** Additional temperature change in degrees Celsius required when the change reverses. */
+constexpr uint8_t TempHysteresis{1U};
+
+/** Temperature change in degrees Celsius between consecutive samples reported immediately. */
+constexpr uint8_t TempRateLimit{3U};
+} // namespace config
+} // namespace logic
@@ -0,0 +1,110 @@
+/**
+ * @brief Implementation of compile-time sized groups of hardware devices.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace logic
+{
+/**
+ * @brief Class for implementation of compile-time sized groups of hardware devices.
+ * 
+ *        The group only holds references to the devices, which must outlive the group. 
+ *        The number of devices is known at compile time, so loops over the group have fixed 
+ *        bounds, and the method to call on each device is passed as a template parameter, so 
+ *        the call is resolved at compile time. If the device type is a final driver class, 
+ *        such as driver::gpio::Atmega328p, the calls are bound statically.
+ * 
+ *        This class is non-assignable.
+ * 
+ * @tparam Device The device type, such as driver::gpio::Interface.
+ * @tparam Count  The number of devices in the group. Must be greater than 0.
+ */
+template <typename Device, uint8_t Count>
+class DeviceGroup
+{
+    // Generate a compiler error if the group is empty.
+    static_assert(0U < Count, "Device group must contain at least one device!");
+
+public:
+    /**
+     * @brief Create device group.
+     * 
+     * @tparam Devices The device types. Must match the number of devices in the group.
+     * 
+     * @param[in] devices The devices to add to the group.
+     */
+    template <typename... Devices>
+    explicit DeviceGroup(Devices&... devices) noexcept;
+
+    /**
+     * @brief Create copy of device group. The devices are shared between the groups.
+     * 
+     * @param[in] other The group to copy.
+     */
+    DeviceGroup(const DeviceGroup& other) noexcept = default;
+
+    /**
+     * @brief Delete device group. The devices are not affected.
+     */
+    ~DeviceGroup() noexcept = default;
+
+    /**
+     * @brief Get the number of devices in the group.
+     * 
+     * @return The number of devices in the group.
+     */
+    static constexpr uint8_t size() noexcept;
+
+    /**
+     * @brief Get device at given index.
+     * 
+     * @param[in] index The index of the device. Must be less than the group size.
+     * 
+     * @return Reference to the device at given index.
+     */
+    Device& operator[](uint8_t index) const noexcept;
+
+    /**
+     * @brief Call given method on each device in the group.
+     * 
+     * @tparam Method Pointer to the method to call.
+     * @tparam Args   The argument types.
+     * 
+     * @param[in] args The arguments to pass to each call.
+     */
+    template <auto Method, typename... Args>
+    void forEach(const Args&... args) const noexcept;
+
+    /**
+     * @brief Check whether given method returns true for all devices in the group.
+     * 
+     * @tparam Method Pointer to the method to call. Must take no arguments.
+     * 
+     * @return True if the method returned true for all devices, false otherwise.
+     */
+    template <auto Method>
+    bool all() const noexcept;
+
+    /**
+     * @brief Check whether given method returns true for any device in the group.
+     * 
+     * @tparam Method Pointer to the method to call. Must take no arguments.
+     * 
+     * @return True if the method returned true for any device, false otherwise.
+     */
+    template <auto Method>
+    bool any() const noexcept;
+
+    DeviceGroup()                              = delete; // No default constructor.
+    DeviceGroup& operator=(const DeviceGroup&) = delete; // No copy assignment.
+    DeviceGroup& operator=(DeviceGroup&&)      = delete; // No move assignment.
+
+private:
+    /** Pointers to the devices in the group. */
+    Device* const myDevices[Count];
+};
+} // namespace logic
+
+#include "impl/device_group_impl.h"
@@ -0,0 +1,62 @@
+/**
+ * @brief Implementation details of logic::DeviceGroup class.
+ * 
+ * @note Don't include this header, use <device_group.h> instead!
+ */
+#pragma once
+
+namespace logic
+{
+// -----------------------------------------------------------------------------
+template <typename Device, uint8_t Count>
+template <typename... Devices>
+DeviceGroup<Device, Count>::DeviceGroup(Devices&... devices) noexcept
+    : myDevices{&devices...}
+{
+    // Generate a compiler error if the number of devices doesn't match the group size.
+    static_assert(Count == sizeof...(Devices), "Device count must match the group size!");
+}
+
+// -----------------------------------------------------------------------------
+template <typename Device, uint8_t Count>
+constexpr uint8_t DeviceGroup<Device, Count>::size() noexcept { return Count; }
+
+// -----------------------------------------------------------------------------
+template <typename Device, uint8_t Count>
+Device& DeviceGroup<Device, Count>::operator[](const uint8_t index) const noexcept 
+{ 
+    return *myDevices[index]; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename Device, uint8_t Count>
+template <auto Method, typename... Args>
+void DeviceGroup<Device, Count>::forEach(const Args&... args) const noexcept
+{
+    for (uint8_t i{}; i < Count; ++i) { (myDevices[i]->*Method)(args...); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Device, uint8_t Count>
+template <auto Method>
+bool DeviceGroup<Device, Count>::all() const noexcept
+{
+    for (uint8_t i{}; i < Count; ++i) 
+    { 
+        if (!(myDevices[i]->*Method)()) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Device, uint8_t Count>
+template <auto Method>
+bool DeviceGroup<Device, Count>::any() const noexcept
+{
+    for (uint8_t i{}; i < Count; ++i) 
+    { 
+        if ((myDevices[i]->*Method)()) { return true; }
+    }
+    return false;
+}
+} // namespace logic
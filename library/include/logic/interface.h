@@ -3,8 +3,22 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 namespace logic
 {
+/**
+ * @brief Enumeration of events handled by the logic.
+ */
+enum class Event : uint8_t
+{
+    None,                 // No event.
+    ButtonEvent,          // Button event.
+    DebounceTimerTimeout, // Debounce timer timeout.
+    ToggleTimerTimeout,   // Toggle timer timeout.
+    WatchdogTimeout,      // Watchdog timer timeout.
+};
+
 /**
  * @brief Generic logic for an MCU with configurable hardware devices.
  */
@@ -30,6 +44,19 @@ public:
      */
     virtual void run(const bool& stop) noexcept = 0;
 
+    /**
+     * @brief Post event to be handled by the run loop.
+     * 
+     *        This method is safe to call from interrupt context. The event queue has a single 
+     *        producer, so the callers must not preempt each other. This holds for interrupt 
+     *        service routines on AVR, since they don't nest.
+     * 
+     * @param[in] event The event to post.
+     * 
+     * @return True if the event was posted, false if the event queue is full.
+     */
+    virtual bool post(Event event) noexcept = 0;
+
     /**
      * @brief Handle button event.
      * 
@@ -54,10 +81,18 @@ public:
     virtual void handleToggleTimerTimeout() noexcept = 0;
 
     /**
-     * @brief Handle temperature timer timeout.
+     * @brief Handle tick timer timeout.
+     * 
+     *        Advance the task scheduler by one tick. This method is safe to call from interrupt 
+     *        context.
+     */
+    virtual void handleTickTimerTimeout() noexcept = 0;
+
+    /**
+     * @brief Handle watchdog timer timeout.
      * 
-     *        Read the surrounding temperature.
+     *        Save the crash context right before the system is reset.
      */
-    virtual void handleTempTimerTimeout() noexcept = 0;
+    virtual void handleWatchdogTimeout() noexcept = 0;
 };
 } // namespace logic
\ No newline at end of file
@@ -3,6 +3,16 @@
  */
 #pragma once
 
+#include "container/spsc_queue.h"
+#include "diag/crash_log.h"
+#include "fsm/state_machine.h"
+#include "scheduler/scheduler.h"
+#include "stats/running_stats.h"
+#include "driver/eeprom/slot.h"
+#include "driver/tempsensor/change_detector.h"
+#include "driver/watchdog/supervisor.h"
+#include "logic/config.h"
+#include "logic/device_group.h"
 #include "logic/interface.h"
 
 namespace driver
@@ -16,6 +26,9 @@ namespace eeprom { class Interface; }
 /** GPIO interface. */
 namespace gpio { class Interface; }
 
+/** Power management interface. */
+namespace power { class Interface; }
+
 /** Serial transmission interface. */
 namespace serial { class Interface; }
 
@@ -36,46 +49,75 @@ namespace logic
  * @brief Generic logic for an MCU with configurable hardware devices.
  * 
  *        The following devices are used:
- *            - A button to toggle a blink timer.
- *            - A button to read the surrounding temperature.
- *            - A blink timer to toggle an LED when enabled.
- *            - A temperature timer to print the temperature on timeout.
+ *            - Buttons to toggle a blink timer.
+ *            - Buttons to read the surrounding temperature.
+ *            - A blink timer to toggle the LEDs when enabled.
+ *            - A tick timer driving a cooperative task scheduler, which samples the temperature 
+ *              and prints the CPU load and the memory usage periodically.
  *            - A debounce timer to reduce the effect of contact bounces after pushing the buttons.
  *            - A serial device to print serial data via UART.
  *            - A watchdog timer to restart the program if it gets stuck somewhere.
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
  *              last stored state before power down was "on," the LED will automatically blink.
- *            - A temperature sensor to read the surrounding temperature.
+ *            - Temperature sensors to read the surrounding temperature.
+ *            - A power management device to put the CPU to sleep between interrupts.
+ * 
+ *        The interrupt service routines only post events to a lock-free event queue, which is
+ *        drained by the run loop. The handle methods handle an event immediately instead.
+ * 
+ *        The button and LED behavior is expressed as table-driven state machines.
+ * 
+ *        The LEDs, buttons and temperature sensors are passed as device groups, whose sizes 
+ *        are set in the compile-time configuration (see logic/config.h).
+ * 
+ *        The temperature of each sensor is reported when it changes (see 
+ *        driver::tempsensor::ChangeDetector), or at least once per temperature period. The
+ *        report-on-change mode can be disabled in the compile-time configuration, in which case 
+ *        the temperature is reported once per temperature period.
  * 
  *        This class is non-copyable and non-movable.
  */
 class Logic : public Interface
 {
 public:
+    /** Group of LEDs toggled by the toggle timer. */
+    using LedGroup = DeviceGroup<driver::gpio::Interface, config::LedCount>;
+
+    /** Group of buttons toggling the toggle timer. */
+    using ToggleButtonGroup = DeviceGroup<driver::gpio::Interface, config::ToggleButtonCount>;
+
+    /** Group of buttons printing the temperature. */
+    using TempButtonGroup = DeviceGroup<driver::gpio::Interface, config::TempButtonCount>;
+
+    /** Group of temperature sensors. */
+    using TempSensorGroup = DeviceGroup<driver::tempsensor::Interface, config::TempSensorCount>;
+
     /**
      * @brief Constructor.
      *     
-     * @param[in] led The LED to toggle.
-     * @param[in] toggleButton Button to toggle the toggle timer.
-     * @param[in] tempButton Button to read the temperature.
+     * @param[in] leds The LEDs to toggle.
+     * @param[in] toggleButtons Buttons to toggle the toggle timer.
+     * @param[in] tempButtons Buttons to read the temperature.
      * @param[in] debounceTimer Timer to mitigate effects of contact bounces.
      * @param[in] toggleTimer Timer to toggle the LED.
-     * @param[in] tempTimer Timer to read the temperature.
+     * @param[in] tickTimer Timer generating the ticks of the task scheduler.
      * @param[in] serial Serial device to print status messages.
      * @param[in] watchdog Watchdog timer that resets the program if it becomes unresponsive.
      * @param[in] eeprom EEPROM stream to write the status of the LED to EEPROM.
-     * @param[in] tempSensor Temperature sensor.
+     * @param[in] tempSensors Temperature sensors.
+     * @param[in] power Power management to put the CPU to sleep between interrupts.
      */
-    explicit Logic(driver::gpio::Interface& led,
-                   driver::gpio::Interface& toggleButton,
-                   driver::gpio::Interface& tempButton, 
+    explicit Logic(const LedGroup& leds,
+                   const ToggleButtonGroup& toggleButtons,
+                   const TempButtonGroup& tempButtons, 
                    driver::timer::Interface& debounceTimer, 
                    driver::timer::Interface& toggleTimer,
-                   driver::timer::Interface& tempTimer,
+                   driver::timer::Interface& tickTimer,
                    driver::serial::Interface& serial, 
                    driver::watchdog::Interface& watchdog, 
                    driver::eeprom::Interface& eeprom, 
-                   driver::tempsensor::Interface& tempSensor) noexcept;
+                   const TempSensorGroup& tempSensors,
+                   driver::power::Interface& power) noexcept;
 
     /**
      * @brief Destructor.
@@ -92,15 +134,32 @@ public:
     /**
      * @brief Run the system.  
      * 
+     *        Handle the events posted by the interrupt service routines, then put the CPU to 
+     *        sleep until the next interrupt. The watchdog is serviced each time the CPU wakes up.
+     * 
      * @param[in] stop Reference to stop flag.                                                            
      */
     void run(const bool& stop) noexcept override;
 
+    /**
+     * @brief Post event to be handled by the run loop.
+     * 
+     *        This method is safe to call from interrupt context. The event queue has a single 
+     *        producer, so the callers must not preempt each other. This holds for interrupt 
+     *        service routines on AVR, since they don't nest. Events posted while the event queue 
+     *        is full are dropped and reported by the run loop.
+     * 
+     * @param[in] event The event to post.
+     * 
+     * @return True if the event was posted, false if the event queue is full.
+     */
+    bool post(Event event) noexcept override;
+
     /**
      * @brief Handle button event.
      * 
      *        Toggle the timer whenever the toggle button is pressed. 
-     *        Predict the temperature and restart the temperature timer whenever the temperature 
+     *        Predict the temperature and restart the temperature period whenever the temperature 
      *        button is pressed.
      * 
      *        Pin change interrupts are disabled for a debounce period after detecting button
@@ -124,11 +183,19 @@ public:
     void handleToggleTimerTimeout() noexcept override;
 
     /**
-     * @brief Handle temperature timer timeout.
+     * @brief Handle tick timer timeout.
      * 
-     *        Read the surrounding temperature.
+     *        Advance the task scheduler by one tick. This method is safe to call from interrupt 
+     *        context.
      */
-    void handleTempTimerTimeout() noexcept override;
+    void handleTickTimerTimeout() noexcept override;
+
+    /**
+     * @brief Handle watchdog timer timeout.
+     * 
+     *        Save the crash context right before the system is reset.
+     */
+    void handleWatchdogTimeout() noexcept override;
 
     Logic()                        = delete; // No default constructor.
     Logic(const Logic&)            = delete; // No copy constructor.
@@ -139,29 +206,58 @@ public:
 protected:
     driver::serial::Interface& serial() noexcept { return mySerial; }
     driver::eeprom::Interface& eeprom() noexcept { return myEeprom; }
-    driver::tempsensor::Interface& tempSensor() noexcept { return myTempSensor; }
+    const TempSensorGroup& tempSensors() const noexcept { return myTempSensors; }
     static uint16_t toggleStateAddr() noexcept { return ToggleStateAddr; }
+    uint16_t deadlineMissCount() const noexcept { return myScheduler.deadlineMissCount(); }
 
     virtual void writeToggleStateToEeprom(bool enable) noexcept;
     virtual bool readToggleStateFromEeprom() const noexcept;
     virtual void printTemperature() noexcept;
 
 private:
-    void handleToggleButtonPressed() noexcept;
-    void handleTempButtonPressed() noexcept;
-    void restoreToggleStateFromEeprom() noexcept;
+    struct Behavior;
 
-    /** Toggle state address in EEPROM. */
+    void restoreToggleStateFromEeprom() noexcept;
+    void sampleTemperature() noexcept;
+    void printSensorTemperature(uint8_t index) noexcept;
+    void reportTemperatureChanges() noexcept;
+    void handleEvents() noexcept;
+    void dispatch(Event event) noexcept;
+    void superviseTasks() noexcept;
+    void reportEventOverflows() noexcept;
+    void reportDeadlineMisses() noexcept;
+    void reportCpuLoad() noexcept;
+    void reportMemoryUsage() noexcept;
+    uint16_t ticks(uint32_t duration_ms) const noexcept;
+
+    static void supervisionTask(void* context) noexcept;
+    static void samplingTask(void* context) noexcept;
+    static void temperatureTask(void* context) noexcept;
+    void reportCrash() noexcept;
+
+    /** Start address of the toggle state region in EEPROM. */
     static constexpr uint16_t ToggleStateAddr{0U};
 
-    /** Reference to the LED to toggle. */
-    driver::gpio::Interface& myLed;
+    /** Size of the toggle state region in EEPROM (spreads the writes across 21 records). */
+    static constexpr uint16_t ToggleStateRegionSize{64U};
+
+    /** Capacity of the event queue. */
+    static constexpr uint8_t EventQueueCapacity{16U};
+
+    /** Address of the crash record in EEPROM, placed after the toggle state region. */
+    static constexpr uint16_t CrashRecordAddr{ToggleStateAddr + ToggleStateRegionSize};
+
+    /** Size of the EEPROM region in use, ending with the reserved crash record slot. */
+    static constexpr uint16_t EepromUsedSize{CrashRecordAddr + diag::CrashLog::SlotSize};
+
+    /** LEDs to toggle. */
+    const LedGroup myLeds;
 
-    /** Button to toggle the toggle timer. */
-    driver::gpio::Interface& myToggleButton;
+    /** Buttons to toggle the toggle timer. */
+    const ToggleButtonGroup myToggleButtons;
 
-    /** Button to read the temperature. */
-    driver::gpio::Interface& myTempButton;
+    /** Buttons to read the temperature. */
+    const TempButtonGroup myTempButtons;
 
     /** Debounce timer to mitigate effects of contact bounces. */
     driver::timer::Interface& myDebounceTimer;
@@ -169,8 +265,8 @@ private:
     /** Timer to toggle the LED. */
     driver::timer::Interface& myToggleTimer;
 
-    /** Timer to read the temperature. */
-    driver::timer::Interface& myTempTimer;
+    /** Timer generating the ticks of the task scheduler. */
+    driver::timer::Interface& myTickTimer;
 
     /** Serial device to print status messages. */
     driver::serial::Interface& mySerial;
@@ -181,7 +277,52 @@ private:
     /** EEPROM stream to write the status of the LED to EEPROM. */
     driver::eeprom::Interface& myEeprom;
 
-    /** Temperature sensor. */
-    driver::tempsensor::Interface& myTempSensor;
+    /** Temperature sensors. */
+    const TempSensorGroup myTempSensors;
+
+    /** Power management to put the CPU to sleep between interrupts. */
+    driver::power::Interface& myPower;
+
+    /** Wear-leveled EEPROM slot holding the toggle state. */
+    driver::eeprom::Slot<uint8_t> myToggleState;
+
+    /** Supervisor that only resets the watchdog while all supervised tasks are alive. */
+    driver::watchdog::Supervisor mySupervisor;
+
+    /** Crash log holding the context of the last watchdog timeout. */
+    diag::CrashLog myCrashLog;
+
+    /** Uptime in seconds. */
+    volatile uint16_t myUptime;
+
+    /** The last event handled. */
+    volatile Event myLastEvent;
+
+    /** Queue holding events posted from interrupt context. */
+    container::SpscQueue<Event, EventQueueCapacity> myEvents;
+
+    /** The number of dropped events at the last report. */
+    uint16_t myReportedOverflowCount;
+
+    /** Cooperative scheduler running the periodic tasks. */
+    scheduler::Scheduler myScheduler;
+
+    /** The number of scheduler deadline misses at the last report. */
+    uint16_t myReportedMissCount;
+
+    /** Streaming statistics of the temperature samples since the last report, per sensor. */
+    stats::RunningStats myTempStats[config::TempSensorCount];
+
+    /** Change detectors deciding when to report the temperature, per sensor. */
+    driver::tempsensor::ChangeDetector myTempDetectors[config::TempSensorCount];
+
+    /** State machine handling the buttons and the debouncing. */
+    fsm::StateMachine<Logic> myButtonStates;
+
+    /** State machine handling the LED. */
+    fsm::StateMachine<Logic> myLedStates;
+
+    /** Indicate whether a missed deadline has been reported. */
+    bool myDeadlineMissReported;
 };
 } // namespace logic
\ No newline at end of file
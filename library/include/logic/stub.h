@@ -23,6 +23,7 @@ public:
     using Logic::toggleStateAddr;
     using Logic::writeToggleStateToEeprom;
     using Logic::readToggleStateFromEeprom;
+    using Logic::deadlineMissCount;
 
     /**
      * @brief Destructor.
@@ -35,7 +36,7 @@ public:
     void printTemperature() noexcept override
     {
         // Read and print the temperature.
-        serial().printf("Simulated temperature: %d Celsius\n", tempSensor().read());
+        serial().printf("Simulated temperature: %d Celsius\n", tempSensors()[0U].read());
         myTempPrintouts++;
     }
 
@@ -44,6 +44,15 @@ public:
      */
     double predict(double input) const noexcept override;
 
+    /**
+     * @brief Get the revision of the model.
+     * 
+     *        The revision is incremented each time the model is trained successfully.
+     * 
+     * @return The revision of the model.
+     */
+    uint16_t revision() const noexcept override;
+
     /**
      * @brief Train the model.
      * 
@@ -72,6 +81,9 @@ private:
     /** Model bias (m-value.) */
     double myBias;
 
+    /** Model revision, incremented on each successful training. */
+    uint16_t myRevision;
+
     /** Indicate whether the model is trained. */
     bool myTrained;
 };
@@ -3,6 +3,8 @@
  */
 #pragma once
 
+#include <stdint.h>
+
 namespace ml
 {
 namespace lin_reg
@@ -33,6 +35,16 @@ public:
      * @return The predicted value.
      */
     virtual double predict(double input) const noexcept = 0;
+
+    /**
+     * @brief Get the revision of the model.
+     * 
+     *        The revision is incremented each time the model is trained, which enables users to
+     *        detect when values derived from the model must be recomputed.
+     * 
+     * @return The revision of the model.
+     */
+    virtual uint16_t revision() const noexcept = 0;
 };
 } // namespace lin_reg
 } // namespace ml
\ No newline at end of file
@@ -0,0 +1,181 @@
+/**
+ * @brief Cooperative run-to-completion task scheduler.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace scheduler
+{
+/**
+ * @brief Structure holding the configuration of a scheduled task.
+ */
+struct Task
+{
+    /** Task function, which runs to completion. */
+    void (*callback)(void* context);
+
+    /** Context passed to the task function. */
+    void* context;
+
+    /** Period in ticks (0 = one-shot task). */
+    uint16_t period;
+
+    /** Delay in ticks before the first release (0 = release immediately). */
+    uint16_t delay;
+
+    /** Maximum number of ticks from release to completion (0 = no deadline). */
+    uint16_t deadline;
+
+    /** Priority of the task (0 = highest priority). */
+    uint8_t priority;
+};
+
+/**
+ * @brief Cooperative run-to-completion task scheduler.
+ * 
+ *        The scheduler holds a static table of up to eight periodic or one-shot tasks, which 
+ *        are released by a single tick generated by calling tick() periodically. Released tasks
+ *        are run to completion in priority order by run(), ties are broken by the lowest task
+ *        ID. The completion time of each task is compared to its deadline; a task that misses
+ *        its deadline, or is released again before it has run, is counted as a deadline miss.
+ * 
+ *        Only tick() may be called from interrupt context; ticks are accumulated and processed
+ *        by the next call to run().
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Scheduler
+{
+public:
+    /** Maximum number of scheduled tasks. */
+    static constexpr uint8_t MaxTaskCount{8U};
+
+    /**
+     * @brief Constructor.
+     */
+    Scheduler() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Scheduler() noexcept = default;
+
+    /**
+     * @brief Add task to schedule. The delay of the task starts counting immediately.
+     * 
+     * @param[in] id The task ID (0 - 7).
+     * @param[in] task The task configuration.
+     * 
+     * @return True if the task was added, false if the task ID or task function is invalid.
+     */
+    bool addTask(uint8_t id, const Task& task) noexcept;
+
+    /**
+     * @brief Remove scheduled task.
+     * 
+     * @param[in] id The task ID (0 - 7).
+     */
+    void removeTask(uint8_t id) noexcept;
+
+    /**
+     * @brief Schedule the next release of a task, which restarts the period of periodic tasks
+     *        and re-arms one-shot tasks.
+     * 
+     * @param[in] id The task ID (0 - 7).
+     * @param[in] delay The number of ticks before the release (0 = release immediately).
+     * 
+     * @return True if the release was scheduled, false if the task doesn't exist.
+     */
+    bool schedule(uint8_t id, uint16_t delay) noexcept;
+
+    /**
+     * @brief Advance the scheduler by one tick. This method is safe to call from interrupt 
+     *        context.
+     */
+    void tick() noexcept;
+
+    /**
+     * @brief Process the accumulated ticks, then run all released tasks in priority order.
+     * 
+     * @return The number of tasks that were run.
+     */
+    uint8_t run() noexcept;
+
+    /**
+     * @brief Check whether the scheduler is idle, i.e. whether there are no ticks to process.
+     * 
+     *        Call with interrupts disabled before putting the CPU to sleep.
+     * 
+     * @return True if the scheduler is idle, false otherwise.
+     */
+    bool isIdle() const noexcept;
+
+    /**
+     * @brief Get the number of processed ticks.
+     * 
+     * @return The number of processed ticks (wraps around).
+     */
+    uint16_t tickCount() const noexcept;
+
+    /**
+     * @brief Get the mask of scheduled tasks.
+     * 
+     * @return Mask with the bits of scheduled tasks set.
+     */
+    uint8_t taskMask() const noexcept;
+
+    /**
+     * @brief Get the number of deadline misses of a task.
+     * 
+     * @param[in] id The task ID (0 - 7).
+     * 
+     * @return The number of deadline misses of the task.
+     */
+    uint16_t deadlineMissCount(uint8_t id) const noexcept;
+
+    /**
+     * @brief Get the total number of deadline misses of all tasks.
+     * 
+     * @return The total number of deadline misses.
+     */
+    uint16_t deadlineMissCount() const noexcept;
+
+    Scheduler(const Scheduler&)            = delete; // No copy constructor.
+    Scheduler(Scheduler&&)                 = delete; // No move constructor.
+    Scheduler& operator=(const Scheduler&) = delete; // No copy assignment.
+    Scheduler& operator=(Scheduler&&)      = delete; // No move assignment.
+
+private:
+    void processTicks() noexcept;
+    void release(uint8_t id) noexcept;
+    int8_t nextTask() const noexcept;
+
+    /** Configuration of each task. */
+    Task myTasks[MaxTaskCount];
+
+    /** Remaining ticks of each armed task until its next release. */
+    uint16_t myRemaining[MaxTaskCount];
+
+    /** Tick count at the last release of each task. */
+    uint16_t myReleaseTick[MaxTaskCount];
+
+    /** The number of deadline misses of each task. */
+    uint16_t myMissCount[MaxTaskCount];
+
+    /** The number of processed ticks. */
+    uint16_t myTickCount;
+
+    /** The number of ticks left to process. */
+    volatile uint8_t myPendingTicks;
+
+    /** Mask of scheduled tasks. */
+    uint8_t myTaskMask;
+
+    /** Mask of armed tasks, i.e. tasks counting down to their next release. */
+    uint8_t myArmedMask;
+
+    /** Mask of released tasks waiting to run. */
+    uint8_t myReadyMask;
+};
+} // namespace scheduler
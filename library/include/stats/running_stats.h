@@ -0,0 +1,168 @@
+/**
+ * @brief Streaming statistics computed in constant time and memory.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace stats
+{
+/**
+ * @brief Streaming statistics computed in constant time and memory.
+ * 
+ *        The mean and variance are updated with Welford's algorithm, which is numerically
+ *        stable without storing the samples. The minimum, maximum, mean and variance cover the 
+ *        samples added since the last reset, while the exponentially weighted moving average
+ *        (EWMA) continues across resets to provide a smoothed value at all times.
+ * 
+ *        The statistics are computed with integer math only. The mean, variance, standard 
+ *        deviation and EWMA are stored in fixed-point format with 8 fractional bits and are 
+ *        available both in this format (the _q8 methods) and rounded to integers. Deviations 
+ *        from the mean are limited to 127 units when accumulating the variance.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class RunningStats
+{
+public:
+    /** The number of fractional bits of the fixed-point statistics. */
+    static constexpr uint8_t Shift{8U};
+
+    /** Default weight of each new sample in the EWMA as a power of two (2^-3 = 0.125). */
+    static constexpr uint8_t DefaultEwmaShift{3U};
+
+    /** Maximal weight shift of the EWMA (2^-8). */
+    static constexpr uint8_t MaxEwmaShift{8U};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] ewmaShift Weight of each new sample in the EWMA as a power of two, i.e. the 
+     *                      weight is 2^-ewmaShift (default = 3, i.e. 0.125). Shifts greater 
+     *                      than MaxEwmaShift are replaced by the default shift.
+     */
+    explicit RunningStats(uint8_t ewmaShift = DefaultEwmaShift) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~RunningStats() noexcept = default;
+
+    /**
+     * @brief Add sample.
+     * 
+     * @param[in] sample The sample to add.
+     */
+    void add(int16_t sample) noexcept;
+
+    /**
+     * @brief Reset the statistics of the samples added so far. The EWMA is kept.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Get the number of samples added since the last reset.
+     * 
+     * @return The number of samples (saturates at the maximum value).
+     */
+    uint16_t count() const noexcept;
+
+    /**
+     * @brief Get the mean of the samples added since the last reset.
+     * 
+     * @return The mean rounded to the nearest integer, or 0 if no samples have been added.
+     */
+    int16_t mean() const noexcept;
+
+    /**
+     * @brief Get the mean of the samples added since the last reset.
+     * 
+     * @return The mean in fixed-point format, or 0 if no samples have been added.
+     */
+    int32_t mean_q8() const noexcept;
+
+    /**
+     * @brief Get the sample variance of the samples added since the last reset.
+     * 
+     * @return The sample variance in fixed-point format, or 0 if less than two samples have 
+     *         been added.
+     */
+    uint32_t variance_q8() const noexcept;
+
+    /**
+     * @brief Get the sample standard deviation of the samples added since the last reset.
+     * 
+     * @return The sample standard deviation rounded to the nearest integer, or 0 if less than 
+     *         two samples have been added.
+     */
+    int16_t stdDev() const noexcept;
+
+    /**
+     * @brief Get the sample standard deviation of the samples added since the last reset.
+     * 
+     * @return The sample standard deviation in fixed-point format, or 0 if less than two 
+     *         samples have been added.
+     */
+    uint32_t stdDev_q8() const noexcept;
+
+    /**
+     * @brief Get the minimum of the samples added since the last reset.
+     * 
+     * @return The minimum, or 0 if no samples have been added.
+     */
+    int16_t min() const noexcept;
+
+    /**
+     * @brief Get the maximum of the samples added since the last reset.
+     * 
+     * @return The maximum, or 0 if no samples have been added.
+     */
+    int16_t max() const noexcept;
+
+    /**
+     * @brief Get the exponentially weighted moving average (EWMA) of all samples.
+     * 
+     * @return The EWMA rounded to the nearest integer, or 0 if no samples have been added.
+     */
+    int16_t ewma() const noexcept;
+
+    /**
+     * @brief Get the exponentially weighted moving average (EWMA) of all samples.
+     * 
+     * @return The EWMA in fixed-point format, or 0 if no samples have been added.
+     */
+    int32_t ewma_q8() const noexcept;
+
+    RunningStats(const RunningStats&)            = delete; // No copy constructor.
+    RunningStats(RunningStats&&)                 = delete; // No move constructor.
+    RunningStats& operator=(const RunningStats&) = delete; // No copy assignment.
+    RunningStats& operator=(RunningStats&&)      = delete; // No move assignment.
+
+private:
+    void updateEwma(int32_t sample) noexcept;
+
+    /** Mean of the samples in fixed-point format. */
+    int32_t myMean;
+
+    /** Sum of squared differences from the mean in fixed-point format. */
+    uint32_t mySumSquares;
+
+    /** Exponentially weighted moving average of the samples in fixed-point format. */
+    int32_t myEwma;
+
+    /** Minimum of the samples. */
+    int16_t myMin;
+
+    /** Maximum of the samples. */
+    int16_t myMax;
+
+    /** The number of samples. */
+    uint16_t myCount;
+
+    /** Weight of each new sample in the EWMA as a power of two. */
+    const uint8_t myEwmaShift;
+
+    /** Indicate whether the EWMA has been initialized by a first sample. */
+    bool myEwmaInitialized;
+};
+} // namespace stats
@@ -0,0 +1,143 @@
+/**
+ * @brief Heap accounting for the allocations made via utils::newMemory, 
+ *        utils::reallocMemory and utils::deleteMemory.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace utils
+{
+namespace heap
+{
+/** The number of call sites tracked separately, other call sites are counted as untracked. */
+constexpr uint8_t MaxSiteCount{8U};
+
+/**
+ * @brief Structure of heap statistics.
+ */
+struct Stats
+{
+    /** The number of bytes currently allocated. */
+    size_t liveBytes;
+
+    /** The highest number of bytes allocated at the same time. */
+    size_t peakBytes;
+
+    /** The number of blocks currently allocated. */
+    uint16_t liveBlocks;
+
+    /** The number of allocations. */
+    uint16_t allocCount;
+
+    /** The number of reallocations. */
+    uint16_t reallocCount;
+
+    /** The number of deallocations. */
+    uint16_t freeCount;
+
+    /** The number of failed allocations and reallocations. */
+    uint16_t failedCount;
+
+    /** The number of allocations and reallocations made from untracked call sites. */
+    uint16_t untrackedCount;
+};
+
+/**
+ * @brief Structure of call site statistics.
+ */
+struct Site
+{
+    /** Address of the call site (look it up in the map file or with addr2line). */
+    const void* address;
+
+    /** The number of allocations and reallocations made from the call site. */
+    uint16_t count;
+};
+
+/**
+ * @brief Check whether heap accounting is enabled.
+ * 
+ *        Heap accounting is enabled by defining DIAG_HEAP. Each block then carries a small 
+ *        header holding its size.
+ * 
+ * @return True if heap accounting is enabled, false otherwise.
+ */
+constexpr bool isEnabled() noexcept
+{
+#ifdef DIAG_HEAP
+    return true;
+#else
+    return false;
+#endif /** DIAG_HEAP */
+}
+
+/**
+ * @brief Allocate block with accounting. Use utils::newMemory instead of this function.
+ * 
+ * @param[in] size The block size in bytes.
+ * 
+ * @return Pointer to the allocated block, or nullptr on failure.
+ */
+void* allocate(size_t size) noexcept;
+
+/**
+ * @brief Reallocate block with accounting. Use utils::reallocMemory instead of this function.
+ * 
+ * @param[in] block The block to reallocate, allocated by allocate or reallocate.
+ * @param[in] size The new block size in bytes.
+ * 
+ * @return Pointer to the reallocated block, or nullptr on failure.
+ */
+void* reallocate(void* block, size_t size) noexcept;
+
+/**
+ * @brief Release block with accounting. Use utils::deleteMemory instead of this function.
+ * 
+ * @param[in] block The block to release, allocated by allocate or reallocate.
+ */
+void release(void* block) noexcept;
+
+/**
+ * @brief Get the heap statistics.
+ * 
+ * @return The heap statistics.
+ */
+Stats stats() noexcept;
+
+/**
+ * @brief Get the number of tracked call sites.
+ * 
+ * @return The number of tracked call sites.
+ */
+uint8_t siteCount() noexcept;
+
+/**
+ * @brief Get the statistics of given call site.
+ * 
+ * @param[in] index The index of the call site.
+ * @param[out] site Reference to structure for storing the call site statistics.
+ * 
+ * @return True if the statistics were read, false if the index is invalid.
+ */
+bool site(uint8_t index, Site& site) noexcept;
+
+/**
+ * @brief Get the size of the largest free block, i.e. the largest block that can currently
+ *        be allocated.
+ * 
+ *        The free list and the space between the heap and the stack are inspected on target. 
+ *        The test suite uses the host allocator, hence 0 is always returned.
+ * 
+ * @return The size of the largest free block in bytes.
+ */
+size_t largestFreeBlock() noexcept;
+
+/**
+ * @brief Reset the peak usage to the current usage and clear all counters.
+ */
+void reset() noexcept;
+
+} // namespace heap
+} // namespace utils
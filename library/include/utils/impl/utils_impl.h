@@ -133,21 +133,33 @@ inline T* newObject(Args&&... args) noexcept
 template <typename T>
 inline T* newMemory(const size_t size) noexcept
 {
+#ifdef DIAG_HEAP
+    return static_cast<T*>(heap::allocate(sizeof(T) * size));
+#else
     return static_cast<T*>(malloc(sizeof(T) * size));
+#endif /** DIAG_HEAP */
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 inline T* reallocMemory(T* block, const size_t newSize) noexcept
 {
+#ifdef DIAG_HEAP
+    return static_cast<T*>(heap::reallocate(block, sizeof(T) * newSize));
+#else
     return static_cast<T*>(realloc(block, sizeof(T) * newSize));
+#endif /** DIAG_HEAP */
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 inline void deleteMemory(T* &block) noexcept
 {
+#ifdef DIAG_HEAP
+    heap::release(block);
+#else
     free(block);
+#endif /** DIAG_HEAP */
     block = nullptr;
 }
 
@@ -242,4 +242,16 @@ struct is_reference<T&>
 {
     static const bool value{true};
 };
+
+/**
+ * @brief Check if given type is trivially copyable, i.e. it can be copied byte by byte.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_trivially_copyable
+{
+    // Evaluated by the compiler, since this property can't be deduced within the language.
+    static const bool value{__is_trivially_copyable(T)};
+};
 } // namespace type_traits
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include "utils/heap.h"
 #include "utils/type_traits.h"
 
 namespace utils 
@@ -242,9 +243,11 @@ inline T* newObject(Args&&... args) noexcept;
  * @return A pointer to the new object.
  * 
  *         If the memory allocation fails, a nullptr is returned. 
+ * 
+ * @note Always inlined, so the heap diagnostics attribute the allocation to the caller.
  */
 template <typename T>
-inline T* newMemory(size_t size = 1U) noexcept;
+__attribute__((always_inline)) inline T* newMemory(size_t size = 1U) noexcept;
 
 /**
  * @brief Resize referenced heap allocated block via reallocation.
@@ -256,9 +259,11 @@ inline T* newMemory(size_t size = 1U) noexcept;
  *                    after reallocation.
  *
  * @return A pointer to the resized block at success, else a nullptr.
+ * 
+ * @note Always inlined, so the heap diagnostics attribute the allocation to the caller.
  */
 template <typename T>
-inline T* reallocMemory(T* block, size_t newSize) noexcept;
+__attribute__((always_inline)) inline T* reallocMemory(T* block, size_t newSize) noexcept;
 
 /**
  * @brief Delete heap allocated block via deallocation. 
@@ -270,7 +275,7 @@ inline T* reallocMemory(T* block, size_t newSize) noexcept;
  * @param[in] block Reference to the block to delete.
  */
 template <typename T>
-inline void deleteMemory(T* &block) noexcept;
+__attribute__((always_inline)) inline void deleteMemory(T* &block) noexcept;
 
 /**
  * @brief Move memory from given source to a copy. 
@@ -31,6 +31,19 @@ void executeAssemblyCmd(const std::string& cmd) noexcept
     else if ("CLI" == cmd) { CLR(SREG, I_FLAG); }
     // No-op: watchdog counter reset not needed in unit tests.
     else if ("WDR" == cmd) {}
+    else if ("SLEEP" == cmd)
+    {
+        // Simulate that the CPU is woken up once a conversion started in ADC noise reduction 
+        // mode is complete. Any other sleep returns immediately.
+        constexpr std::uint8_t sleepModeMask{(1U << SM2) | (1U << SM1) | (1U << SM0)};
+        const bool adcNoiseReduction{(1U << SM0) == (SMCR & sleepModeMask)};
+
+        if (READ(SMCR, SE) && adcNoiseReduction && READ(ADCSRA, ADEN)) 
+        { 
+            CLR(ADCSRA, ADSC);
+            SET(ADCSRA, ADIF);
+        }
+    }
 }
 
 // -----------------------------------------------------------------------------
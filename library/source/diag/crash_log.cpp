@@ -0,0 +1,54 @@
+/**
+ * @brief Crash log implementation details.
+ */
+#include "arch/avr/hw_platform.h"
+#include "diag/crash_log.h"
+#include "driver/eeprom/interface.h"
+
+namespace diag
+{
+namespace
+{
+/**
+ * @brief Structure of crash log parameters.
+ */
+struct CrashLogParam
+{
+    /** Marker indicating that a crash record is saved. */
+    static constexpr uint8_t Saved{0xA5U};
+
+    /** Marker indicating that no crash record is saved (erased state). */
+    static constexpr uint8_t Cleared{0xFFU};
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+CrashLog::CrashLog(driver::eeprom::Interface& eeprom, const uint16_t address) noexcept
+    : myEeprom{eeprom}
+    , myAddress{address}
+{}
+
+// -----------------------------------------------------------------------------
+bool CrashLog::save(const Record& record) noexcept
+{
+    // Write the record first, then mark it as saved. Bypass the write queue, since the record
+    // is saved from the watchdog interrupt, where interrupts must stay disabled.
+    return myEeprom.updateObjectFromIsr(myAddress + 1U, record) 
+        && myEeprom.updateObjectFromIsr(myAddress, CrashLogParam::Saved);
+}
+
+// -----------------------------------------------------------------------------
+bool CrashLog::load(Record& record) const noexcept
+{
+    // Return false if no record is saved.
+    uint8_t marker{};
+    if (!myEeprom.read(myAddress, marker) || (CrashLogParam::Saved != marker)) { return false; }
+    return myEeprom.readObject(myAddress + 1U, record);
+}
+
+// -----------------------------------------------------------------------------
+bool CrashLog::clear() noexcept { return myEeprom.updateObject(myAddress, CrashLogParam::Cleared); }
+
+// -----------------------------------------------------------------------------
+uint16_t CrashLog::stackPointer() noexcept { return SP; }
+} // namespace diag
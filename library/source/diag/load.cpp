@@ -0,0 +1,120 @@
+/**
+ * @brief CPU load meter implementation details.
+ */
+#include "arch/avr/hw_platform.h"
+#include "diag/load.h"
+#include "diag/probe.h"
+#include "utils/utils.h"
+
+namespace diag
+{
+namespace load
+{
+namespace
+{
+/** The number of time base counts per ms. */
+constexpr uint32_t CountsPerMs{2000U};
+
+/** Full load in percent. */
+constexpr uint32_t FullLoad{100U};
+
+/** Time spent in instrumented interrupt service routines, updated in interrupt context. */
+volatile uint32_t myIsrTime{};
+
+/** Time spent sleeping in the current measurement window. */
+uint32_t myIdleTime{};
+
+/** Timestamp of the last time the CPU went to sleep. */
+uint16_t myIdleStart{};
+
+/** Interrupt time at the last time the CPU went to sleep. */
+uint32_t myIdleStartIsrTime{};
+
+/** CPU load of the last completed measurement window in percent. */
+uint8_t myCpuLoad{};
+
+/** Peak CPU load in percent. */
+uint8_t myPeakLoad{};
+
+/** Interrupt share of the last completed measurement window in percent. */
+uint8_t myIsrShare{};
+
+// -----------------------------------------------------------------------------
+uint32_t isrTime() noexcept
+{
+    // Read the interrupt time with interrupts disabled, since it's updated in interrupt context.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    const uint32_t time{myIsrTime};
+    SREG = sreg;
+    return time;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t percent(const uint32_t time, const uint32_t window) noexcept
+{
+    return window > time ? static_cast<uint8_t>(time * FullLoad / window) : FullLoad;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+IsrScope::IsrScope() noexcept
+    : myStart{TCNT1}
+{}
+
+// -----------------------------------------------------------------------------
+IsrScope::~IsrScope() noexcept 
+{ 
+    // Interrupts are disabled in interrupt context, so the time base is read directly.
+    myIsrTime = myIsrTime + static_cast<uint16_t>(TCNT1 - myStart); 
+}
+
+// -----------------------------------------------------------------------------
+void enterIdle() noexcept
+{
+    myIdleStart        = probe::now();
+    myIdleStartIsrTime = isrTime();
+}
+
+// -----------------------------------------------------------------------------
+void exitIdle() noexcept
+{
+    // Don't count the interrupt time while sleeping (such as the wake-up interrupt) as idle.
+    const uint16_t sleepTime{static_cast<uint16_t>(probe::now() - myIdleStart)};
+    const uint32_t isrTimeWhileIdle{isrTime() - myIdleStartIsrTime};
+    if (sleepTime > isrTimeWhileIdle) { myIdleTime += sleepTime - isrTimeWhileIdle; }
+}
+
+// -----------------------------------------------------------------------------
+void update(const uint16_t window_ms) noexcept
+{
+    if (0U == window_ms) { return; }
+    const uint32_t window{window_ms * CountsPerMs};
+
+    // Collect and clear the interrupt time of the completed window.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    const uint32_t windowIsrTime{myIsrTime};
+    myIsrTime = 0U;
+    SREG = sreg;
+
+    // All time not spent sleeping is counted as load.
+    myCpuLoad  = static_cast<uint8_t>(FullLoad - percent(myIdleTime, window));
+    myIsrShare = percent(windowIsrTime, window);
+    if (myCpuLoad > myPeakLoad) { myPeakLoad = myCpuLoad; }
+    myIdleTime = 0U;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t cpuLoad() noexcept { return myCpuLoad; }
+
+// -----------------------------------------------------------------------------
+uint8_t peakLoad() noexcept { return myPeakLoad; }
+
+// -----------------------------------------------------------------------------
+uint8_t isrShare() noexcept { return myIsrShare; }
+
+// -----------------------------------------------------------------------------
+void resetPeak() noexcept { myPeakLoad = myCpuLoad; }
+} // namespace load
+} // namespace diag
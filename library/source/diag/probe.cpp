@@ -0,0 +1,130 @@
+/**
+ * @brief Latency probe implementation details.
+ */
+#include "arch/avr/hw_platform.h"
+#include "diag/probe.h"
+#include "driver/serial/interface.h"
+#include "utils/utils.h"
+
+namespace diag
+{
+namespace probe
+{
+namespace
+{
+/** Upper bound of the first histogram bucket in time base counts (4 us). */
+constexpr uint16_t FirstBucketLimit{8U};
+
+/** Probe names, indexed by probe ID. */
+constexpr const char* Names[Id::Count]
+{
+    "Timer ISR", "Button event", "Debounce timeout", "Toggle timeout", 
+    "Tick timeout", "Scheduled tasks", "EEPROM write", "Watchdog write"
+};
+
+/** Statistics of each probe. */
+Stats myStats[Id::Count]{};
+
+// -----------------------------------------------------------------------------
+uint8_t bucket(const uint16_t duration) noexcept
+{
+    // Each bucket covers twice the durations of the previous one.
+    uint8_t index{};
+    uint16_t limit{FirstBucketLimit};
+
+    while (((BucketCount - 1U) > index) && (duration >= limit))
+    {
+        index++;
+        limit <<= 1U;
+    }
+    return index;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Scope::Scope(const uint8_t id) noexcept
+    : myStart{now()}
+    , myId{id}
+{}
+
+// -----------------------------------------------------------------------------
+Scope::~Scope() noexcept { record(myId, now() - myStart); }
+
+// -----------------------------------------------------------------------------
+uint16_t now() noexcept
+{
+    // Read the counter with interrupts disabled, since the timer interrupt updates another
+    // 16-bit register sharing the same temporary register.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    const uint16_t time{TCNT1};
+    SREG = sreg;
+    return time;
+}
+
+// -----------------------------------------------------------------------------
+void record(const uint8_t id, const uint16_t duration) noexcept
+{
+    if (Id::Count <= id) { return; }
+
+    // Update the statistics with interrupts disabled, restore the interrupt state afterwards
+    // so the function can be used both in interrupt and thread context.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    Stats& stats{myStats[id]};
+
+    // Stop recording once the counter saturates, the statistics are stable by then.
+    if (UINT16_MAX > stats.count)
+    {
+        if ((0U == stats.count) || (duration < stats.min)) { stats.min = duration; }
+        if (duration > stats.max) { stats.max = duration; }
+        stats.sum += duration;
+        stats.count++;
+        stats.histogram[bucket(duration)]++;
+    }
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+bool stats(const uint8_t id, Stats& stats) noexcept
+{
+    if (Id::Count <= id) { return false; }
+
+    // Copy the statistics with interrupts disabled to get a consistent snapshot.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    stats = myStats[id];
+    SREG = sreg;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void reset() noexcept
+{
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    for (auto& stats : myStats) { stats = Stats{}; }
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void print(const driver::serial::Interface& serial) noexcept
+{
+    for (uint8_t id{}; id < Id::Count; ++id)
+    {
+        Stats probe{};
+        if (!stats(id, probe) || (0U == probe.count)) { continue; }
+
+        // Print the durations in us, followed by the histogram.
+        serial.printf("%s: count %u, min %u us, max %u us, avg %u us\n", Names[id], probe.count, 
+                      static_cast<uint16_t>(toMicroseconds(probe.min)), 
+                      static_cast<uint16_t>(toMicroseconds(probe.max)),
+                      static_cast<uint16_t>(toMicroseconds(probe.sum / probe.count)));
+        const uint16_t* histogram{probe.histogram};
+        serial.printf("  <4:%u <8:%u <16:%u <32:%u <64:%u <128:%u <256:%u >=256:%u\n", 
+                      histogram[0U], histogram[1U], histogram[2U], histogram[3U], 
+                      histogram[4U], histogram[5U], histogram[6U], histogram[7U]);
+    }
+}
+} // namespace probe
+} // namespace diag
@@ -0,0 +1,89 @@
+/**
+ * @brief Stack painting implementation details.
+ */
+#include "diag/stack.h"
+
+#ifndef TESTSUITE
+
+/** End of the static data, i.e. the start of the heap (provided by the linker). */
+extern uint8_t _end;
+
+/** Top of the stack (provided by the linker). */
+extern uint8_t __stack;
+
+/** Current end of the heap, nullptr if nothing has been allocated (provided by avr-libc). */
+extern char* __brkval;
+
+/**
+ * @brief Paint the RAM between the static data and the top of the stack before main is called.
+ * 
+ *        The function is placed in the .init3 section, which runs after the stack pointer and
+ *        the zero register have been set up, but before any stack is used. Hence it must be 
+ *        naked and not call any functions.
+ */
+extern "C" void diagPaintStack() __attribute__((naked, used, section(".init3")));
+
+// -----------------------------------------------------------------------------
+extern "C" void diagPaintStack() 
+{
+    for (uint8_t* byte{&_end}; byte <= &__stack; ++byte) { *byte = diag::stack::Pattern; }
+}
+
+#endif /** TESTSUITE */
+
+namespace diag
+{
+namespace stack
+{
+namespace
+{
+#ifndef TESTSUITE
+
+// -----------------------------------------------------------------------------
+const uint8_t* heapEnd() noexcept
+{
+    return nullptr != __brkval ? reinterpret_cast<const uint8_t*>(__brkval) : &_end;
+}
+
+#endif /** TESTSUITE */
+} // namespace
+
+// -----------------------------------------------------------------------------
+void paint(uint8_t* begin, const uint8_t* end) noexcept
+{
+    if ((nullptr == begin) || (nullptr == end)) { return; }
+    for (uint8_t* byte{begin}; byte < end; ++byte) { *byte = Pattern; }
+}
+
+// -----------------------------------------------------------------------------
+uint16_t unusedBytes(const uint8_t* begin, const uint8_t* end) noexcept
+{
+    if ((nullptr == begin) || (nullptr == end)) { return 0U; }
+    const uint8_t* byte{begin};
+    while ((byte < end) && (Pattern == *byte)) { ++byte; }
+    return static_cast<uint16_t>(byte - begin);
+}
+
+// -----------------------------------------------------------------------------
+uint16_t unusedBytes() noexcept
+{
+#ifndef TESTSUITE
+    // Scan from the current end of the heap, since the heap grows into the painted region.
+    return unusedBytes(heapEnd(), &__stack + 1U);
+#else
+    return 0U;
+#endif /** TESTSUITE */
+}
+
+// -----------------------------------------------------------------------------
+uint16_t maxDepth() noexcept
+{
+#ifndef TESTSUITE
+    const uint8_t* const deepest{heapEnd() + unusedBytes()};
+    return static_cast<uint16_t>(&__stack + 1U - deepest);
+#else
+    return 0U;
+#endif /** TESTSUITE */
+}
+} // namespace stack
+} // namespace diag
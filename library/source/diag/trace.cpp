@@ -0,0 +1,139 @@
+/**
+ * @brief Trace buffer implementation details.
+ */
+#include "arch/avr/hw_platform.h"
+#include "diag/trace.h"
+#include "driver/serial/interface.h"
+#include "utils/utils.h"
+
+namespace diag
+{
+namespace trace
+{
+namespace
+{
+// Generate a compiler error if the capacity is invalid.
+static_assert((0U < Capacity) && (0U == (Capacity & (Capacity - 1U))), 
+              "Trace capacity must be a power of two!");
+
+/** Trigger value indicating that no trigger is set. */
+constexpr uint8_t NoTrigger{0xFFU};
+
+/** Trace records, stored in a circular buffer. */
+Record myRecords[Capacity]{};
+
+/** Index of the next record to write. */
+uint8_t myHead{};
+
+/** The number of records in the buffer. */
+uint8_t myCount{};
+
+/** Trigger event ID. */
+uint8_t myTrigger{NoTrigger};
+
+/** The number of events to record after the trigger event. */
+uint8_t myPostCount{};
+
+/** The number of events left to record before freezing, valid once triggered. */
+uint8_t myRemaining{};
+
+/** Indicate whether the trigger event has been recorded. */
+bool myTriggered{};
+
+/** Indicate whether the trace is frozen. */
+volatile bool myFrozen{};
+
+// -----------------------------------------------------------------------------
+uint8_t indexOf(const uint8_t position) noexcept { return position & (Capacity - 1U); }
+} // namespace
+
+// -----------------------------------------------------------------------------
+void record(const uint8_t id, const uint16_t arg) noexcept
+{
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    if (!myFrozen)
+    {
+        // Store the record, overwrite the oldest record if the buffer is full.
+        myRecords[myHead] = Record{TCNT1, arg, id};
+        myHead = indexOf(myHead + 1U);
+        if (Capacity > myCount) { myCount++; }
+
+        // Freeze the trace once the given number of events have followed the trigger.
+        if (myTriggered) 
+        { 
+            if (0U == --myRemaining) { myFrozen = true; }
+        }
+        else if (myTrigger == id) 
+        { 
+            myTriggered = true;
+            myRemaining = myPostCount;
+            if (0U == myRemaining) { myFrozen = true; }
+        }
+    }
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void setTrigger(const uint8_t id, const uint8_t postCount) noexcept
+{
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    myTrigger   = id;
+    myPostCount = postCount;
+    myTriggered = false;
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void freeze() noexcept { myFrozen = true; }
+
+// -----------------------------------------------------------------------------
+bool isFrozen() noexcept { return myFrozen; }
+
+// -----------------------------------------------------------------------------
+uint8_t size() noexcept { return myCount; }
+
+// -----------------------------------------------------------------------------
+bool read(const uint8_t index, Record& record) noexcept
+{
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    const bool valid{myCount > index};
+    if (valid) { record = myRecords[indexOf(myHead - myCount + index)]; }
+    SREG = sreg;
+    return valid;
+}
+
+// -----------------------------------------------------------------------------
+void reset() noexcept
+{
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    myHead      = 0U;
+    myCount     = 0U;
+    myTriggered = false;
+    myFrozen    = false;
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void print(const driver::serial::Interface& serial) noexcept
+{
+    // Freeze the trace while printing, so the records are not overwritten meanwhile.
+    const bool frozen{myFrozen};
+    myFrozen = true;
+
+    // Print one record per line as hexadecimal ID, timestamp and argument.
+    serial.printf("TRACE BEGIN %u\n", myCount);
+    Record record{};
+    for (uint8_t i{}; read(i, record); ++i)
+    {
+        serial.printf("%02X %04X %04X\n", record.id, record.time, record.arg);
+    }
+    serial.printf("TRACE END\n");
+    myFrozen = frozen;
+}
+} // namespace trace
+} // namespace diag
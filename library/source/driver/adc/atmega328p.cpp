@@ -3,6 +3,7 @@
  */
 #include "arch/avr/hw_platform.h"
 #include "driver/adc/atmega328p.h"
+#include "driver/adc/conversion.h"
 #include "utils/utils.h"
 
 namespace driver 
@@ -22,8 +23,11 @@ struct AdcParam
     /** Max value of the ADC (limited by the resolution). */
     static constexpr uint16_t MaxValue{1023U};
 
+    /** Supply voltage in millivolts. */
+    static constexpr uint16_t SupplyVoltage_mV{5000U};
+
     /** Supply voltage in Volts. */
-    static constexpr double SupplyVoltage{5.0};
+    static constexpr double SupplyVoltage{SupplyVoltage_mV / 1000.0};
 
     /** ADC port offset (pin [14:19] == port [A0:A5]). */
     static constexpr uint8_t PortOffset{14U};
@@ -35,6 +39,12 @@ constexpr uint8_t normalizeChannel(const uint8_t channel) noexcept
     return Atmega328p::Pin::A5 >= channel ? channel : channel - AdcParam::PortOffset;
 }
 
+// -----------------------------------------------------------------------------
+constexpr bool isReadModeValid(const ReadMode mode) noexcept
+{
+    return (ReadMode::Polling == mode) || (ReadMode::NoiseReduction == mode);
+}
+
 // -----------------------------------------------------------------------------
 uint16_t adcValue(const uint8_t channel) noexcept
 {
@@ -44,6 +54,28 @@ uint16_t adcValue(const uint8_t channel) noexcept
     utils::set(ADCSRA, ADIF);
     return ADC;
 }
+
+// -----------------------------------------------------------------------------
+uint16_t adcValueNoiseReduced(const uint8_t channel) noexcept
+{
+    // Poll instead if interrupts are disabled, since the CPU would never wake up.
+    if (!utils::read(SREG, I_FLAG)) { return adcValue(channel); }
+
+    // Enable the ADC interrupt to wake up the CPU once the conversion is complete.
+    ADMUX = (1U << REFS0) | normalizeChannel(channel);
+    utils::set(ADCSRA, ADEN, ADIE, ADPS0, ADPS1, ADPS2);
+
+    // Select ADC noise reduction mode, the conversion starts when entering sleep.
+    SMCR = (1U << SM0) | (1U << SE);
+
+    // Sleep until the conversion is complete, other interrupts may wake up the CPU earlier.
+    do { asm("SLEEP"); } while (utils::read(ADCSRA, ADSC));
+
+    // Disable sleep and the ADC interrupt once the conversion is complete.
+    utils::clear(SMCR, SE);
+    utils::clear(ADCSRA, ADIE);
+    return ADC;
+}
 } // namespace 
 
 // -----------------------------------------------------------------------------
@@ -65,10 +97,15 @@ uint16_t Atmega328p::maxValue() const noexcept { return AdcParam::MaxValue; }
 // -----------------------------------------------------------------------------
 double Atmega328p::supplyVoltage() const noexcept { return AdcParam::SupplyVoltage; }
 
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::supplyVoltage_mV() const noexcept { return AdcParam::SupplyVoltage_mV; }
+
 // -----------------------------------------------------------------------------
 uint16_t Atmega328p::read(const uint8_t channel) const noexcept
 { 
-    return myEnabled && isChannelValid(channel) ? adcValue(channel) : 0U;
+    if (!myEnabled || !isChannelValid(channel)) { return 0U; }
+    return ReadMode::NoiseReduction == myReadMode ? 
+        adcValueNoiseReduced(channel) : adcValue(channel);
 }
 
 // -----------------------------------------------------------------------------
@@ -83,6 +120,19 @@ double Atmega328p::inputVoltage(const uint8_t channel) const noexcept
     return dutyCycle(channel) * AdcParam::SupplyVoltage;
 }
 
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::dutyCycle_q15(const uint8_t channel) const noexcept
+{
+    return conversion::dutyCycle_q15(read(channel), AdcParam::MaxValue);
+}
+
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::inputVoltage_mV(const uint8_t channel) const noexcept
+{
+    return conversion::inputVoltage_mV(read(channel), AdcParam::MaxValue, 
+                                       AdcParam::SupplyVoltage_mV);
+}
+
 // -----------------------------------------------------------------------------
 bool Atmega328p::isInitialized() const noexcept { return true; }
 
@@ -92,6 +142,18 @@ bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
 // -----------------------------------------------------------------------------
 void Atmega328p::setEnabled(const bool enable) noexcept { myEnabled = enable; }
 
+// -----------------------------------------------------------------------------
+ReadMode Atmega328p::readMode() const noexcept { return myReadMode; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setReadMode(const ReadMode mode) noexcept
+{
+    // Check the read mode, return false if invalid.
+    if (!isReadModeValid(mode)) { return false; }
+    myReadMode = mode;
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 bool Atmega328p::isChannelValid(const uint8_t channel) const noexcept 
 { 
@@ -101,9 +163,16 @@ bool Atmega328p::isChannelValid(const uint8_t channel) const noexcept
 
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p() noexcept
-    : myEnabled{true}
+    : myReadMode{ReadMode::Polling}
+    , myEnabled{true}
 {
     read(Pin::A0);
 }
+
+// -----------------------------------------------------------------------------
+ISR (ADC_vect) 
+{
+    // No-op: the interrupt only wakes up the CPU from ADC noise reduction mode.
+}
 } // namespace adc
 } // namespace driver
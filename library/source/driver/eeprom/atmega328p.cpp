@@ -2,6 +2,8 @@
  * @brief EEPROM stream implementation details for ATmega328P.
  */
 #include "arch/avr/hw_platform.h"
+#include "diag/probe.h"
+#include "diag/trace.h"
 #include "driver/eeprom/atmega328p.h"
 #include "utils/utils.h"
 
@@ -19,9 +21,102 @@ struct EepromParam
     /** Size of the EEPROM in bytes. */
     static constexpr uint16_t Size{1024U};
 
-    /** Highest EEPROM address. */
-    static constexpr uint16_t MaxAddress{Size - 1U};
+    /** Capacity of the write queue in bytes. */
+    static constexpr uint8_t QueueSize{16U};
 };
+
+/**
+ * @brief Structure of queued write requests.
+ */
+struct WriteRequest
+{
+    /** Callback to invoke once the byte has been written (nullptr = none). */
+    void (*callback)();
+
+    /** The destination address. */
+    uint16_t address;
+
+    /** The data to write. */
+    uint8_t data;
+};
+
+/** Write queue, drained by the EEPROM ready interrupt. */
+WriteRequest myQueue[EepromParam::QueueSize]{};
+
+/** Index of the oldest queued write request. */
+volatile uint8_t myQueueTail{};
+
+/** The number of queued write requests. */
+volatile uint8_t myQueueCount{};
+
+/** Callback to invoke once the ongoing write is complete (nullptr = none). */
+void (*volatile myPendingCallback)(){nullptr};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t queueIndex(const uint8_t index) noexcept
+{
+    return index % EepromParam::QueueSize;
+}
+
+// -----------------------------------------------------------------------------
+void startWrite(const uint16_t address, const uint8_t data, const bool erase = true) noexcept
+{
+    // Set the address and data to write.
+    DIAG_TRACE(diag::trace::Id::EepromWrite, address);
+    EEAR = address;
+    EEDR = data;
+
+    // Select atomic erase and write or write only (bits can only be cleared without erase).
+    utils::clear(EECR, EEPM0, EEPM1);
+    if (!erase) { utils::set(EECR, EEPM1); }
+
+    // Perform write, interrupts must be disabled during the write sequence.
+    utils::set(EECR, EEMPE);
+    utils::set(EECR, EEPE);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t readStored(const uint16_t address) noexcept
+{
+    // Wait until EEPROM is ready to read the next byte.
+    while (utils::read(EECR, EEPE));
+
+    // Set the address from which to read.
+    EEAR = address;
+
+    // Read and return the value of the given address.
+    utils::set(EECR, EERE);
+    return EEDR;
+}
+
+// -----------------------------------------------------------------------------
+void serviceQueue() noexcept
+{
+    // Invoke the callback of the previous write request, which is now complete.
+    if (nullptr != myPendingCallback)
+    {
+        void (*callback)(){myPendingCallback};
+        myPendingCallback = nullptr;
+        callback();
+    }
+
+    // Disable the EEPROM ready interrupt when the write queue is drained.
+    if (0U == myQueueCount) 
+    { 
+        utils::clear(EECR, EERIE);
+        return; 
+    }
+
+    // Start writing the oldest queued byte, its callback is invoked on completion.
+    const WriteRequest& request{myQueue[myQueueTail]};
+    startWrite(request.address, request.data);
+    myPendingCallback = request.callback;
+    myQueueTail       = queueIndex(myQueueTail + 1U);
+    myQueueCount      = myQueueCount - 1U;
+}
+
+// -----------------------------------------------------------------------------
+bool isWritePending() noexcept { return (0U < myQueueCount) || (nullptr != myPendingCallback); }
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -46,48 +141,132 @@ bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
 // -----------------------------------------------------------------------------
 void Atmega328p::setEnabled(const bool enable) noexcept { myEnabled = enable; }
 
+// -----------------------------------------------------------------------------
+void Atmega328p::flush() noexcept
+{
+    // Drain the write queue from the calling thread, one byte at a time. 
+    // Check the EEPROM status with interrupts disabled, since the EEPROM ready interrupt
+    // may start the next write in between. Restore the interrupt state of the caller afterwards.
+    while (isWritePending())
+    {
+        const uint8_t sreg{SREG};
+        utils::globalInterruptDisable();
+        if (!utils::read(EECR, EEPE)) { serviceQueue(); }
+        SREG = sreg;
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::pendingWrites() const noexcept { return myQueueCount; }
+
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p() noexcept
     : myEnabled{false} 
 {}
 
 // -----------------------------------------------------------------------------
-bool Atmega328p::isAddressValid(const uint16_t address, const uint8_t dataSize) const noexcept
+bool Atmega328p::isAddressValid(const uint16_t address, const uint16_t dataSize) const noexcept
 {
-    return EepromParam::MaxAddress >= address + dataSize;
+    // Compare against the remaining size, since the end address may wrap around in 16 bits.
+    return (EepromParam::Size > address) && (EepromParam::Size - address >= dataSize);
 }
 
 // -----------------------------------------------------------------------------
-void Atmega328p::writeByte(const uint16_t address, const uint8_t data) noexcept
+void Atmega328p::writeByte(const uint16_t address, const uint8_t data, const bool erase) noexcept
 {
+    // Complete all queued writes first to preserve the write order.
+    flush();
+
     // Wait until EEPROM is ready to send the next byte.
     while (utils::read(EECR, EEPE));
 
-    // Set the address and data to write.
-    EEAR = address;
-    EEDR = data;
-
     // Perform write, disable interrupts during the write sequence.
+    DIAG_PROBE(diag::probe::Id::EepromWrite);
+    const uint8_t sreg{SREG};
     utils::globalInterruptDisable();
-    utils::set(EECR, EEMPE);
-    utils::set(EECR, EEPE);
+    startWrite(address, data, erase);
 
-    // Re-enable interrupts once the write sequence is complete.
-    utils::globalInterruptEnable();
+    // Restore the interrupt state once the write sequence is complete.
+    SREG = sreg;
 }
 
 // -----------------------------------------------------------------------------
 uint8_t Atmega328p::readByte(const uint16_t address) const noexcept
 {
-    // Wait until EEPROM is ready to read the next byte.
+    // Return the newest queued data for the given address, if any.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    for (uint8_t i{myQueueCount}; 0U < i; --i)
+    {
+        const WriteRequest& request{myQueue[queueIndex(myQueueTail + i - 1U)]};
+
+        if (address == request.address)
+        {
+            SREG = sreg;
+            return request.data;
+        }
+    }
+    SREG = sreg;
+    return readStored(address);
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::writeByteFromIsr(const uint16_t address, const uint8_t data, 
+                                  const bool erase) noexcept
+{
+    // Wait until the ongoing write (if any) is complete, leave the queued writes as they are.
     while (utils::read(EECR, EEPE));
 
-    // Set the address from which to read.
-    EEAR = address;
+    // Perform write with interrupts disabled, then restore the interrupt state of the caller.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    startWrite(address, data, erase);
+    SREG = sreg;
+}
 
-    // Read and return the value of the given address.
-    utils::set(EECR, EERE);
-    return EEDR;
+// -----------------------------------------------------------------------------
+uint8_t Atmega328p::readByteFromIsr(const uint16_t address) const noexcept
+{
+    // Read the stored data, ignoring the queued writes.
+    return readStored(address);
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::enqueue(const uint16_t address, const uint8_t* data, const uint8_t size, 
+                         void (*callback)()) noexcept
+{
+    // Check the input parameters, return false if invalid.
+    if ((nullptr == data) || (0U == size)) { return false; }
+
+    // Update the write queue with interrupts disabled, return false if the data doesn't fit.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    if (EepromParam::QueueSize - myQueueCount < size)
+    {
+        SREG = sreg;
+        return false;
+    }
+
+    // Queue each byte, invoke the callback once the last byte has been written.
+    for (uint8_t i{}; i < size; ++i)
+    {
+        WriteRequest& request{myQueue[queueIndex(myQueueTail + myQueueCount)]};
+        request.callback = (size - 1U) == i ? callback : nullptr;
+        request.address  = address + i;
+        request.data     = data[i];
+        myQueueCount     = myQueueCount + 1U;
+    }
+
+    // Enable the EEPROM ready interrupt to start draining the queue.
+    utils::set(EECR, EERIE);
+    SREG = sreg;
+    return true;
 }
+
+// -----------------------------------------------------------------------------
+ISR (EE_READY_vect) { serviceQueue(); }
+
 } // namespace eeprom
 } // namespace driver
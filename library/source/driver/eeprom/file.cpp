@@ -0,0 +1,198 @@
+/**
+ * @brief File-backed EEPROM stream implementation details for the host platform.
+ */
+#ifdef TESTSUITE
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "driver/eeprom/file.h"
+
+namespace driver 
+{
+namespace eeprom
+{
+namespace
+{
+/**
+ * @brief Structure of file-backed EEPROM parameters.
+ */
+struct FileParam
+{
+    /** Value of erased bytes. */
+    static constexpr std::uint8_t ErasedValue{0xFFU};
+
+    /** Access permissions of created image files. */
+    static constexpr mode_t Permissions{0644};
+};
+
+// -----------------------------------------------------------------------------
+bool createImage(const int fileDescriptor) noexcept
+{
+    // Fill the new image file with erased bytes.
+    std::uint8_t erased[File::Size];
+    std::memset(erased, FileParam::ErasedValue, sizeof(erased));
+    return static_cast<ssize_t>(sizeof(erased)) == write(fileDescriptor, erased, sizeof(erased));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+File::File(const char* path) noexcept
+    : myImage{nullptr}
+    , myFileDescriptor{-1}
+    , myTime_us{}
+    , myReadyTime_us{}
+    , myWriteCount{}
+    , myEnabled{true}
+{
+    if (nullptr == path) { return; }
+    myFileDescriptor = open(path, O_RDWR | O_CREAT, FileParam::Permissions);
+    if (0 > myFileDescriptor) { return; }
+
+    // Create the image if the file is new, then map it into memory.
+    struct stat status{};
+    const bool isValid{(0 == fstat(myFileDescriptor, &status)) 
+        && ((File::Size == status.st_size) 
+            || ((0 == status.st_size) && createImage(myFileDescriptor)))};
+
+    if (isValid)
+    {
+        void* image{mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, myFileDescriptor, 0)};
+        if (MAP_FAILED != image) { myImage = static_cast<std::uint8_t*>(image); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+File::~File() noexcept
+{
+    if (nullptr != myImage) 
+    { 
+        msync(myImage, Size, MS_SYNC);
+        munmap(myImage, Size); 
+    }
+    if (0 <= myFileDescriptor) { close(myFileDescriptor); }
+}
+
+// -----------------------------------------------------------------------------
+std::uint16_t File::size() const noexcept { return Size; }
+
+// -----------------------------------------------------------------------------
+bool File::isInitialized() const noexcept { return nullptr != myImage; }
+
+// -----------------------------------------------------------------------------
+bool File::isEnabled() const noexcept { return myEnabled; }
+
+// -----------------------------------------------------------------------------
+void File::setEnabled(const bool enable) noexcept { myEnabled = enable; }
+
+// -----------------------------------------------------------------------------
+void File::flush() noexcept { waitUntilReady(); }
+
+// -----------------------------------------------------------------------------
+std::uint16_t File::pendingWrites() const noexcept { return 0U; }
+
+// -----------------------------------------------------------------------------
+bool File::isBusy() const noexcept { return myReadyTime_us > myTime_us; }
+
+// -----------------------------------------------------------------------------
+std::uint64_t File::time_us() const noexcept { return myTime_us; }
+
+// -----------------------------------------------------------------------------
+void File::advanceTime(const std::uint64_t duration_us) noexcept { myTime_us += duration_us; }
+
+// -----------------------------------------------------------------------------
+std::uint32_t File::writeCount(const std::uint16_t address) const noexcept
+{
+    return Size > address ? myWriteCount[address] : 0U;
+}
+
+// -----------------------------------------------------------------------------
+std::uint32_t File::maxWriteCount() const noexcept
+{
+    std::uint32_t maxCount{};
+    for (const auto& count : myWriteCount) { if (maxCount < count) { maxCount = count; } }
+    return maxCount;
+}
+
+// -----------------------------------------------------------------------------
+std::uint32_t File::totalWriteCount() const noexcept
+{
+    std::uint32_t totalCount{};
+    for (const auto& count : myWriteCount) { totalCount += count; }
+    return totalCount;
+}
+
+// -----------------------------------------------------------------------------
+void File::waitUntilReady() const noexcept
+{
+    // Busy-wait on EEPE in virtual time, i.e. skip to the end of the ongoing write.
+    if (myReadyTime_us > myTime_us) { myTime_us = myReadyTime_us; }
+}
+
+// -----------------------------------------------------------------------------
+bool File::isAddressValid(const std::uint16_t address, 
+                          const std::uint16_t dataSize) const noexcept
+{
+    // Compare against the remaining size, since the end address may wrap around in 16 bits.
+    return (Size > address) && (Size - address >= dataSize);
+}
+
+// -----------------------------------------------------------------------------
+void File::writeByte(const std::uint16_t address, const std::uint8_t data, 
+                     const bool erase) noexcept
+{
+    if (!myEnabled || !isInitialized() || (Size <= address)) { return; }
+
+    // Wait until the previous write is complete, then program the byte.
+    // Without erase, bits can only be cleared.
+    waitUntilReady();
+    myImage[address] = erase ? data : myImage[address] & data;
+    myWriteCount[address]++;
+    myReadyTime_us = myTime_us + (erase ? EraseWriteTime_us : WriteOnlyTime_us);
+}
+
+// -----------------------------------------------------------------------------
+std::uint8_t File::readByte(const std::uint16_t address) const noexcept
+{
+    if (!myEnabled || !isInitialized() || (Size <= address)) { return 0U; }
+
+    // Wait until the previous write is complete before reading.
+    waitUntilReady();
+    return myImage[address];
+}
+
+// -----------------------------------------------------------------------------
+void File::writeByteFromIsr(const std::uint16_t address, const std::uint8_t data, 
+                            const bool erase) noexcept
+{
+    // Writes are never queued, so write the byte directly.
+    writeByte(address, data, erase);
+}
+
+// -----------------------------------------------------------------------------
+std::uint8_t File::readByteFromIsr(const std::uint16_t address) const noexcept
+{
+    return readByte(address);
+}
+
+// -----------------------------------------------------------------------------
+bool File::enqueue(const std::uint16_t address, const std::uint8_t* data, 
+                   const std::uint8_t size, void (*callback)()) noexcept
+{
+    // Check the input parameters, return false if invalid.
+    if ((nullptr == data) || (0U == size)) { return false; }
+
+    // Write each byte in order, then invoke the callback (if any).
+    for (std::uint8_t i{}; i < size; ++i) { writeByte(address + i, data[i], true); }
+    if (nullptr != callback) { callback(); }
+    return true;
+}
+} // namespace eeprom
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,63 @@
+/**
+ * @brief EEPROM stream interface implementation details.
+ */
+#include "driver/eeprom/interface.h"
+
+namespace driver 
+{
+namespace eeprom
+{
+// -----------------------------------------------------------------------------
+bool Interface::readBlock(const uint16_t address, void* data, const uint16_t size) const noexcept
+{
+    // Return false if the given parameters are invalid or if the EEPROM stream isn't enabled.
+    if ((nullptr == data) || !isAddressValid(address, size) || !isEnabled()) { return false; }
+    uint8_t* bytes{static_cast<uint8_t*>(data)};
+
+    // Read each byte from EEPROM, one at a time.
+    for (uint16_t i{}; i < size; ++i) { bytes[i] = readByte(address + i); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Interface::updateBlock(const uint16_t address, const void* data, const uint16_t size) noexcept
+{
+    // Return false if the given parameters are invalid or if the EEPROM stream isn't enabled.
+    if ((nullptr == data) || !isAddressValid(address, size) || !isEnabled()) { return false; }
+    const uint8_t* bytes{static_cast<const uint8_t*>(data)};
+
+    for (uint16_t i{}; i < size; ++i)
+    {
+        // Skip bytes that are already stored.
+        const uint8_t stored{readByte(address + i)};
+        if (stored == bytes[i]) { continue; }
+
+        // Erased bits read as 1, so skip the erase if only bits are to be cleared.
+        const bool erase{bytes[i] != (stored & bytes[i])};
+        writeByte(address + i, bytes[i], erase);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Interface::updateBlockFromIsr(const uint16_t address, const void* data, 
+                                   const uint16_t size) noexcept
+{
+    // Return false if the given parameters are invalid or if the EEPROM stream isn't enabled.
+    if ((nullptr == data) || !isAddressValid(address, size) || !isEnabled()) { return false; }
+    const uint8_t* bytes{static_cast<const uint8_t*>(data)};
+
+    for (uint16_t i{}; i < size; ++i)
+    {
+        // Compare with the stored byte rather than queued data, which may never be written.
+        const uint8_t stored{readByteFromIsr(address + i)};
+        if (stored == bytes[i]) { continue; }
+
+        // Erased bits read as 1, so skip the erase if only bits are to be cleared.
+        const bool erase{bytes[i] != (stored & bytes[i])};
+        writeByteFromIsr(address + i, bytes[i], erase);
+    }
+    return true;
+}
+} // namespace eeprom
+} // namespace driver
@@ -0,0 +1,148 @@
+/**
+ * @brief Power management driver implementation details for ATmega328P.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/power/atmega328p.h"
+#include "utils/utils.h"
+
+namespace driver 
+{
+namespace power
+{
+namespace 
+{
+/** Default sleep mode (idle, since the hardware timers must keep running). */
+constexpr SleepMode DefaultSleepMode{SleepMode::Idle};
+
+/** Invalid register value, returned for invalid sleep modes and peripherals. */
+constexpr uint8_t InvalidValue{0xFFU};
+
+// -----------------------------------------------------------------------------
+constexpr bool isSleepModeValid(const SleepMode mode) noexcept 
+{ 
+    return SleepMode::Count > mode; 
+}
+
+// -----------------------------------------------------------------------------
+constexpr bool isPeripheralValid(const Peripheral peripheral) noexcept 
+{ 
+    return Peripheral::Count > peripheral; 
+}
+
+// -----------------------------------------------------------------------------
+uint8_t mapSleepMode(const SleepMode mode) noexcept
+{
+    // Map sleep mode to SMCR register value (sleep enable bit excluded).
+    switch (mode)
+    {
+        case SleepMode::Idle:
+            return 0U;
+        case SleepMode::AdcNoiseReduction:
+            return (1U << SM0);
+        case SleepMode::PowerDown:
+            return (1U << SM1);
+        case SleepMode::PowerSave:
+            return (1U << SM1) | (1U << SM0);
+        case SleepMode::Standby:
+            return (1U << SM2) | (1U << SM1);
+        case SleepMode::ExtendedStandby:
+            return (1U << SM2) | (1U << SM1) | (1U << SM0);
+        default:
+            return InvalidValue;
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint8_t mapPeripheral(const Peripheral peripheral) noexcept
+{
+    // Map peripheral to the corresponding power reduction bit in the PRR register.
+    switch (peripheral)
+    {
+        case Peripheral::Adc:
+            return PRADC;
+        case Peripheral::Usart0:
+            return PRUSART0;
+        case Peripheral::Spi:
+            return PRSPI;
+        case Peripheral::Timer0:
+            return PRTIM0;
+        case Peripheral::Timer1:
+            return PRTIM1;
+        case Peripheral::Timer2:
+            return PRTIM2;
+        case Peripheral::Twi:
+            return PRTWI;
+        default:
+            return InvalidValue;
+    }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Interface& Atmega328p::getInstance() noexcept
+{
+    // Create and initialize the singleton power management instance (once only).
+    static Atmega328p myInstance{};
+
+    // Return a reference to the singleton instance, cast to the corresponding interface.
+    return myInstance; 
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isInitialized() const noexcept { return true; }
+
+// -----------------------------------------------------------------------------
+SleepMode Atmega328p::sleepMode() const noexcept { return mySleepMode; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setSleepMode(const SleepMode mode) noexcept
+{
+    // Check the sleep mode, return false if invalid.
+    if (!isSleepModeValid(mode)) { return false; }
+
+    // Store the new sleep mode, it's written to the SMCR register on sleep.
+    mySleepMode = mode;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::sleep() noexcept
+{
+    // Write the entire sleep mode, since other drivers may use other sleep modes.
+    SMCR = mapSleepMode(mySleepMode) | (1U << SE);
+
+    // Enable interrupts and enter sleep, the instruction after SEI is always executed before
+    // any pending interrupt, so no wake-up is missed.
+    utils::globalInterruptEnable();
+    asm("SLEEP");
+
+    // Disable sleep once woken up to prevent accidental sleep.
+    utils::clear(SMCR, SE);
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isPeripheralEnabled(const Peripheral peripheral) const noexcept
+{
+    // The peripheral is enabled if the corresponding power reduction bit is cleared.
+    return isPeripheralValid(peripheral) && !utils::read(PRR, mapPeripheral(peripheral));
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setPeripheralEnabled(const Peripheral peripheral, const bool enable) noexcept
+{
+    // Check the peripheral, return false if invalid.
+    if (!isPeripheralValid(peripheral)) { return false; }
+
+    // Clear the corresponding power reduction bit to enable the peripheral, set it otherwise.
+    const uint8_t bit{mapPeripheral(peripheral)};
+    if (enable) { utils::clear(PRR, bit); }
+    else { utils::set(PRR, bit); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+Atmega328p::Atmega328p() noexcept
+    : mySleepMode{DefaultSleepMode}
+{}
+} // namespace power
+} // namespace driver
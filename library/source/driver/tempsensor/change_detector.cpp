@@ -0,0 +1,93 @@
+/**
+ * @brief Change detector for temperature sensors implementation details.
+ */
+#include <stdint.h>
+
+#include "driver/tempsensor/change_detector.h"
+#include "driver/tempsensor/interface.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr int8_t direction(const int16_t from, const int16_t to) noexcept
+{
+    return from < to ? 1 : (to < from ? -1 : 0);
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint16_t distance(const int16_t from, const int16_t to) noexcept
+{
+    return static_cast<uint16_t>(from < to ? to - from : from - to);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+ChangeDetector::ChangeDetector() noexcept
+    : myConfig{}
+    , myTemperature{}
+    , myPrevious{}
+    , myReported{}
+    , mySilence{}
+    , myDirection{}
+    , myPending{Trigger::None}
+    , mySampled{false}
+    , myHasReported{false}
+{}
+
+// -----------------------------------------------------------------------------
+uint8_t ChangeDetector::update(const Interface& sensor) noexcept
+{
+    // Sample the sensor, keep the previous sample for the rate check.
+    const int16_t temperature{sensor.read()};
+    myPrevious    = mySampled ? myTemperature : temperature;
+    myTemperature = temperature;
+    mySampled     = true;
+    if (UINT16_MAX > mySilence) { ++mySilence; }
+
+    // Keep the first trigger pending until the report is acknowledged.
+    const uint8_t trigger{check()};
+    if (Trigger::None == myPending) { myPending = trigger; }
+    return trigger;
+}
+
+// -----------------------------------------------------------------------------
+void ChangeDetector::acknowledge() noexcept
+{
+    // Make the latest sample the reference for the following changes.
+    const int8_t change{direction(myReported, myTemperature)};
+    if (0 != change) { myDirection = change; }
+    myReported    = myTemperature;
+    myHasReported = true;
+    mySilence     = 0U;
+    myPending     = Trigger::None;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t ChangeDetector::check() const noexcept
+{
+    // Always report the first sample.
+    if (!myHasReported) { return Trigger::Initial; }
+
+    // Report changes exceeding the deadband, add the hysteresis if the direction reverses.
+    const int8_t change{direction(myReported, myTemperature)};
+    const uint16_t threshold{static_cast<uint16_t>(myConfig.deadband 
+        + ((0 != myDirection) && (change == -myDirection) ? myConfig.hysteresis : 0U))};
+    if (threshold < distance(myReported, myTemperature)) { return Trigger::Deadband; }
+
+    // Report fast changes immediately, even within the deadband.
+    if ((0U < myConfig.rateLimit) 
+        && (myConfig.rateLimit <= distance(myPrevious, myTemperature))) { return Trigger::Rate; }
+
+    // Report at least once per silence interval.
+    if ((0U < myConfig.maxSilence) && (myConfig.maxSilence <= mySilence)) 
+    { 
+        return Trigger::Silence; 
+    }
+    return Trigger::None;
+}
+} // namespace tempsensor
+} // namespace driver
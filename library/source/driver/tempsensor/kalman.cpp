@@ -0,0 +1,136 @@
+/**
+ * @brief Temperature sensor smoothed by a scalar Kalman filter implementation details.
+ */
+#include <stdint.h>
+
+#include "driver/tempsensor/kalman.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+namespace
+{
+/**
+ * @brief Structure of filter parameters.
+ */
+struct FilterParam
+{
+    /** The number of fractional bits of the Kalman gain. */
+    static constexpr uint8_t GainShift{12U};
+
+    /** Temperature of 1 degree Celsius in fixed-point format. */
+    static constexpr int32_t Scale{1L << Kalman::Shift};
+
+    /** Kalman gain of 1.0 in fixed-point format. */
+    static constexpr uint32_t UnityGain{1UL << GainShift};
+
+    /** 
+     * Maximal innovation (1024 degrees Celsius) in fixed-point format. Limiting the innovation 
+     * keeps the gain multiplication within 32 bits.
+     */
+    static constexpr int32_t MaxInnovation{1024L * Scale};
+};
+
+// -----------------------------------------------------------------------------
+constexpr uint16_t saturatedSum(const uint16_t x, const uint16_t y) noexcept
+{
+    return UINT16_MAX - x < y ? UINT16_MAX : static_cast<uint16_t>(x + y);
+}
+
+// -----------------------------------------------------------------------------
+constexpr int32_t limit(const int32_t value, const int32_t max) noexcept
+{
+    return max < value ? max : (-max > value ? -max : value);
+}
+
+// -----------------------------------------------------------------------------
+constexpr int32_t multiply(const int32_t value, const uint32_t gain) noexcept
+{
+    // Multiply with the gain, round to the nearest step, halfway cases away from zero.
+    constexpr int32_t rounding{1L << (FilterParam::GainShift - 1U)};
+    const int32_t product{value * static_cast<int32_t>(gain)};
+    return 0 <= product ? (product + rounding) >> FilterParam::GainShift 
+                        : -((rounding - product) >> FilterParam::GainShift);
+}
+
+// -----------------------------------------------------------------------------
+constexpr int16_t toTemperature(const int32_t estimate) noexcept
+{
+    // Round to the nearest integer, halfway cases away from zero.
+    constexpr int32_t rounding{1L << (Kalman::Shift - 1U)};
+    return static_cast<int16_t>(0 <= estimate ? (estimate + rounding) >> Kalman::Shift 
+                                              : -((rounding - estimate) >> Kalman::Shift));
+}
+
+// Verify the fixed-point arithmetic.
+static_assert(128 == multiply(256, FilterParam::UnityGain / 2U), "Gain multiplication failed!");
+static_assert(-128 == multiply(-256, FilterParam::UnityGain / 2U), "Gain multiplication failed!");
+static_assert(-3 == toTemperature(-640), "Rounding of negative estimate failed!");
+static_assert(3 == toTemperature(640), "Rounding of positive estimate failed!");
+} // namespace
+
+// -----------------------------------------------------------------------------
+Kalman::Kalman(const Interface& sensor, const uint16_t processNoise, 
+               const uint16_t measurementNoise) noexcept
+    : mySensor{sensor}
+    , myEstimate{}
+    , myVariance{}
+    , myProcessNoise{processNoise}
+    , myMeasurementNoise{measurementNoise}
+    , myInitialized{false}
+{}
+
+// -----------------------------------------------------------------------------
+bool Kalman::isInitialized() const noexcept { return mySensor.isInitialized(); }
+
+// -----------------------------------------------------------------------------
+int16_t Kalman::read() const noexcept
+{
+    // Return 0 if initialization failed.
+    if (!isInitialized()) { return 0; }
+
+    // Update the estimate with a new reading, return the estimate rounded to an integer.
+    update(mySensor.read());
+    return toTemperature(myEstimate);
+}
+
+// -----------------------------------------------------------------------------
+void Kalman::reset() noexcept
+{
+    myEstimate    = 0;
+    myVariance    = 0U;
+    myInitialized = false;
+}
+
+// -----------------------------------------------------------------------------
+void Kalman::update(const int16_t temperature) const noexcept
+{
+    const int32_t measurement{static_cast<int32_t>(temperature) * FilterParam::Scale};
+
+    // Initialize the estimate with the first reading, which is as uncertain as any reading.
+    if (!myInitialized)
+    {
+        myEstimate    = measurement;
+        myVariance    = myMeasurementNoise;
+        myInitialized = true;
+        return;
+    }
+
+    // Predict: the temperature is unchanged, but its uncertainty grows by the process noise.
+    const uint16_t variance{saturatedSum(myVariance, myProcessNoise)};
+
+    // Update: weigh the reading by the Kalman gain K = P / (P + R), then shrink the variance
+    // P = (1 - K) * P. The variance fits in 16 bits, so the scaled products fit in 32 bits.
+    const uint32_t divisor{static_cast<uint32_t>(variance) + myMeasurementNoise};
+    const uint32_t gain{0U < divisor ? 
+        ((static_cast<uint32_t>(variance) << FilterParam::GainShift) + divisor / 2U) / divisor 
+        : FilterParam::UnityGain};
+    const int32_t innovation{limit(measurement - myEstimate, FilterParam::MaxInnovation)};
+
+    myEstimate += multiply(innovation, gain);
+    myVariance  = static_cast<uint16_t>((variance * (FilterParam::UnityGain - gain) 
+        + (FilterParam::UnityGain / 2U)) >> FilterParam::GainShift);
+}
+} // namespace tempsensor
+} // namespace driver
@@ -1 +1,135 @@
-//! @todo Add smart temperature sensor implementation details here!
+/**
+ * @brief Smart temperature sensor implementation details.
+ */
+#include <stdint.h>
+
+#include "driver/adc/interface.h"
+#include "driver/tempsensor/smart.h"
+#include "ml/lin_reg/interface.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+namespace
+{
+/**
+ * @brief Structure of table parameters.
+ */
+struct TableParam
+{
+    /** 
+     * The number of fractional bits of the table entries. The interpolation fits in 32 bits 
+     * for ADC resolutions up to 10 bits.
+     */
+    static constexpr uint8_t Shift{8U};
+
+    /** Minimal table entry (the minimal temperature in fixed-point format). */
+    static constexpr int32_t Min{static_cast<int32_t>(INT16_MIN) * (1L << Shift)};
+
+    /** Maximal table entry (the maximal temperature in fixed-point format). */
+    static constexpr int32_t Max{static_cast<int32_t>(INT16_MAX) * (1L << Shift)};
+};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t computeSegmentShift(const uint8_t resolution) noexcept
+{
+    // Split the ADC codes evenly between the segments (16 segments = 4 bits).
+    constexpr uint8_t segmentBits{4U};
+    static_assert((1U << segmentBits) == Smart::SegmentCount, "Invalid segment count!");
+    return segmentBits < resolution ? resolution - segmentBits : 0U;
+}
+
+// -----------------------------------------------------------------------------
+constexpr int32_t toFixed(const double temperature) noexcept
+{
+    // Convert to fixed-point format, saturate to the range of the output.
+    const double scaled{temperature * (1L << TableParam::Shift)};
+    if (TableParam::Min > scaled) { return TableParam::Min; }
+    if (TableParam::Max < scaled) { return TableParam::Max; }
+    return utils::round<int32_t>(scaled);
+}
+
+// -----------------------------------------------------------------------------
+constexpr int16_t toTemperature(const int32_t value) noexcept
+{
+    // Round to the nearest integer, halfway cases away from zero.
+    constexpr int32_t rounding{1L << (TableParam::Shift - 1U)};
+    return static_cast<int16_t>(0 <= value ? (value + rounding) >> TableParam::Shift 
+                                           : -((rounding - value) >> TableParam::Shift));
+}
+
+// -----------------------------------------------------------------------------
+constexpr int16_t interpolate(const int32_t start, const int32_t end, const uint16_t offset, 
+                              const uint8_t shift) noexcept
+{
+    // Interpolate between the segment boundaries, the offset is less than the segment width.
+    return toTemperature(start + ((end - start) * static_cast<int32_t>(offset)) / (1L << shift));
+}
+
+// Verify the fixed-point conversions.
+static_assert(25 == toTemperature(toFixed(25.4)), "Fixed-point conversion failed for 25.4!");
+static_assert(-26 == toTemperature(toFixed(-25.5)), "Fixed-point conversion failed for -25.5!");
+static_assert(INT16_MAX == toTemperature(toFixed(1e6)), "Fixed-point saturation failed!");
+static_assert(INT16_MIN == toTemperature(toFixed(-1e6)), "Fixed-point saturation failed!");
+static_assert(5 == interpolate(toFixed(0.0), toFixed(10.0), 32U, 6U), 
+    "Interpolation failed at the middle of the segment!");
+} // namespace
+
+// -----------------------------------------------------------------------------
+Smart::Smart(const uint8_t pin, adc::Interface& adc, const ml::lin_reg::Interface& linReg) noexcept
+    : myAdc{adc}
+    , myLinReg{linReg}
+    , myTable{}
+    , myRevision{}
+    , mySegmentShift{computeSegmentShift(adc.resolution())}
+    , myPin{pin}
+    , myTableValid{false}
+{
+    // Enable the ADC if the initialization succeeded.
+    if (isInitialized()) { myAdc.setEnabled(true); }
+}
+
+// -----------------------------------------------------------------------------
+bool Smart::isInitialized() const noexcept 
+{ 
+    // Return true if the temperature sensor pin is valid, the ADC is initialized with a 
+    // supported resolution and the model is trained.
+    return myAdc.isChannelValid(myPin) && myAdc.isInitialized() 
+        && (MaxResolution >= myAdc.resolution()) && myLinReg.isTrained(); 
+}
+
+// -----------------------------------------------------------------------------
+int16_t Smart::read() const noexcept
+{
+    // Return 0 if initialization failed.
+    if (!isInitialized()) { return 0; }
+
+    // Rebuild the table if the model has been retrained since the last read.
+    if (!myTableValid || (myLinReg.revision() != myRevision)) { updateTable(); }
+
+    // Look up the segment of the ADC value, interpolate between its boundaries.
+    const uint16_t adcVal{myAdc.read(myPin)};
+    const uint8_t segment{static_cast<uint8_t>(adcVal >> mySegmentShift)};
+    const uint16_t offset{static_cast<uint16_t>(adcVal - (segment << mySegmentShift))};
+    return interpolate(myTable[segment], myTable[segment + 1U], offset, mySegmentShift);
+}
+
+// -----------------------------------------------------------------------------
+void Smart::updateTable() const noexcept
+{
+    // Predict the temperature at each segment boundary. The last boundary lies one step 
+    // above the maximal ADC value, which is fine since the model is linear.
+    const double voltagePerStep{myAdc.supplyVoltage() / myAdc.maxValue()};
+
+    for (uint8_t i{}; i <= SegmentCount; ++i)
+    {
+        const uint16_t adcVal{static_cast<uint16_t>(i << mySegmentShift)};
+        myTable[i] = toFixed(myLinReg.predict(adcVal * voltagePerStep));
+    }
+    myRevision   = myLinReg.revision();
+    myTableValid = true;
+}
+} // namespace tempsensor
+} // namespace driver
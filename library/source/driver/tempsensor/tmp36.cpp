@@ -5,15 +5,63 @@
 
 #include "driver/adc/interface.h"
 #include "driver/tempsensor/tmp36.h"
-#include "utils/utils.h"
 
 namespace driver
 {
 namespace tempsensor
 {
+namespace
+{
+/**
+ * @brief Structure of TMP36 parameters.
+ */
+struct Tmp36Param
+{
+    /** Output voltage change per degree Celsius in millivolts. */
+    static constexpr uint16_t Slope_mV{10U};
+
+    /** Temperature offset in degrees Celsius (the output is 500 mV at 0 degrees Celsius). */
+    static constexpr int16_t Offset{50};
+
+    /** 
+     * The number of fractional bits of the gain. The scaled ADC value fits in 32 bits for 
+     * supply voltages up to 10 V.
+     */
+    static constexpr uint8_t GainShift{22U};
+};
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t computeGain(const uint16_t supplyVoltage_mV, const uint16_t maxValue) noexcept
+{
+    // Calculate the temperature per ADC step, T = Uin / 10 mV, rounded to the nearest integer.
+    const uint64_t divisor{static_cast<uint64_t>(Tmp36Param::Slope_mV) * maxValue};
+    return 0U < divisor ? static_cast<uint32_t>(
+        ((static_cast<uint64_t>(supplyVoltage_mV) << Tmp36Param::GainShift) + divisor / 2U) 
+        / divisor) : 0U;
+}
+
+// -----------------------------------------------------------------------------
+constexpr int16_t computeTemperature(const uint16_t adcVal, const uint32_t gain) noexcept
+{
+    // Scale the ADC value, round to the nearest integer before removing the offset.
+    constexpr uint32_t rounding{1UL << (Tmp36Param::GainShift - 1U)};
+    const uint32_t temperature{(adcVal * gain + rounding) >> Tmp36Param::GainShift};
+    return static_cast<int16_t>(temperature) - Tmp36Param::Offset;
+}
+
+// Verify the conversion for the ATmega328P ADC (5 V supply voltage, 10-bit resolution).
+static_assert(-50 == computeTemperature(0U, computeGain(5000U, 1023U)), 
+    "TMP36 conversion failed for ADC value 0!");
+static_assert(0 == computeTemperature(102U, computeGain(5000U, 1023U)), 
+    "TMP36 conversion failed for ADC value 102!");
+static_assert(450 == computeTemperature(1023U, computeGain(5000U, 1023U)), 
+    "TMP36 conversion failed for ADC value 1023!");
+} // namespace
+
 // -----------------------------------------------------------------------------
 Tmp36::Tmp36(const uint8_t pin, adc::Interface& adc) noexcept
     : myAdc{adc}
+    , myGain{computeGain(adc.supplyVoltage_mV(), adc.maxValue())}
     , myPin{pin}
 {
     // Enable the ADC if the initialization succeeded.
@@ -33,9 +81,8 @@ int16_t Tmp36::read() const noexcept
     // Return 0 if initialization failed.
     if (!isInitialized()) { return 0; }
 
-    // Return the temperature, rounded to the nearest integer.
-    const double temperature{100.0 * myAdc.inputVoltage(myPin) - 50.0};
-    return utils::round<int16_t>(temperature);
+    // Return the temperature, T = 100 * Uin - 50, rounded to the nearest integer.
+    return computeTemperature(myAdc.read(myPin), myGain);
 }
 } // namespace tempsensor
 } // namespace driver
@@ -3,6 +3,8 @@
  */
 #include "arch/avr/hw_platform.h"
 #include "container/array.h"
+#include "diag/load.h"
+#include "diag/probe.h"
 #include "driver/timer/atmega328p.h" 
 #include "utils/callback_array.h"
 #include "utils/utils.h"
@@ -60,6 +62,9 @@ constexpr uint8_t CircuitCount{3U};
 /** Time between each timer interrupt in ms. */
 constexpr double InterruptIntervalMs{0.128};
 
+/** The number of Timer 1 counts between each interrupt, matching the other timers. */
+constexpr uint16_t Timer1Interval{256U};
+
 /** Array holding pointers to timers. */
 Atmega328p* myTimers[CircuitCount]{};  
 
@@ -73,6 +78,18 @@ constexpr uint32_t maxCount(const uint32_t timeout_ms) noexcept
         utils::round<uint32_t>(timeout_ms / InterruptIntervalMs) : 0U;
 }
 
+// -----------------------------------------------------------------------------
+void scheduleTimer1Match() noexcept
+{
+	// Schedule the next compare match one interval from now, since Timer 1 keeps running while
+	// the timer is stopped or while an interrupt is serviced late. Clear any stale match.
+	const uint8_t sreg{SREG};
+	utils::globalInterruptDisable();
+	OCR1A = TCNT1 + Timer1Interval;
+	TIFR1 = (1U << OCF1A);
+	SREG  = sreg;
+}
+
 // -----------------------------------------------------------------------------
 void invokeCallback(const uint8_t timerIndex) noexcept
 {
@@ -80,6 +97,8 @@ void invokeCallback(const uint8_t timerIndex) noexcept
 	if (CircuitCount <= timerIndex) { return; }
     
 	// Invoke callback.
+	DIAG_ISR();
+	DIAG_PROBE(diag::probe::Id::TimerIsr);
 	Atmega328p* timer{myTimers[timerIndex]};
     if (nullptr != timer) { timer->handleCallback(); }
 }
@@ -135,6 +154,7 @@ void Atmega328p::setTimeout_ms(const uint32_t timeout_ms) noexcept
 void Atmega328p::start() noexcept
 { 
 	if (0U == myMaxCount) { return; }
+	if ((Index::Timer1 == myHw->index) && !myEnabled) { scheduleTimer1Match(); }
     utils::globalInterruptEnable();
 	utils::set(*(myHw->maskReg), myHw->maskBit);
 	myEnabled = true;
@@ -233,9 +253,9 @@ void Atmega328p::Hardware::release(Atmega328p::Hardware* hw) noexcept
 // -----------------------------------------------------------------------------
 Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex) noexcept
 {
-    constexpr uint16_t timer1MaxCount{256U};  
+    constexpr uint16_t timer1MaxCount{Timer1Interval};  
 	constexpr uint8_t controlBits0{(1U << CS01)};
-	constexpr uint8_t controlBits1{(1U << CS11) | (1U << WGM12)};
+	constexpr uint8_t controlBits1{(1U << CS11)};
 	constexpr uint8_t controlBits2{(1U << CS21)};
 
 	// Allocate memory for the new timer hardware, return false is memory allocation failed.
@@ -275,7 +295,15 @@ Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex) noexc
 ISR (TIMER0_OVF_vect) { invokeCallback(Index::Timer0); }
 
 // -----------------------------------------------------------------------------
-ISR (TIMER1_COMPA_vect) { invokeCallback(Index::Timer1); }
+ISR (TIMER1_COMPA_vect) 
+{ 
+	// Schedule the next compare match, Timer 1 is running freely so it can be used as time base.
+	// Re-arm from the current count if the match has already passed, i.e. if the interrupt was
+	// serviced more than one interval late, which would otherwise delay it a full wraparound.
+	OCR1A += Timer1Interval;
+	if (Timer1Interval < static_cast<uint16_t>(OCR1A - TCNT1)) { OCR1A = TCNT1 + Timer1Interval; }
+	invokeCallback(Index::Timer1); 
+}
 
 // -----------------------------------------------------------------------------
 ISR (TIMER2_OVF_vect) { invokeCallback(Index::Timer2); }
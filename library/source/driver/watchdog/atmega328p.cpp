@@ -2,6 +2,7 @@
  * @brief Watchdog timer driver implementation details for ATmega328P.
  */
 #include "arch/avr/hw_platform.h"
+#include "diag/probe.h"
 #include "utils/utils.h"
 #include "driver/watchdog/atmega328p.h"
 
@@ -14,6 +15,9 @@ namespace
 /** Default watchdog timeout (1024 ms). */
 constexpr Atmega328p::Timeout DefaultTimeout{Atmega328p::Timeout::Duration1024ms};
 
+/** Callback to invoke on watchdog timeout (nullptr = none). */
+void (*myTimeoutCallback)(){nullptr};
+
 // -----------------------------------------------------------------------------
 constexpr bool isTimeoutValid(const Atmega328p::Timeout timeout) noexcept
 {
@@ -91,10 +95,18 @@ void Atmega328p::setEnabled(const bool enable) noexcept
     reset();
 
     // Update the enablement status, disable interrupts during the write sequence.
+    DIAG_PROBE(diag::probe::Id::WatchdogWrite);
     utils::globalInterruptDisable();
     utils::set(WDTCSR, WDCE, WDE);
-    if (enable) { utils::set(WDTCSR, WDE); }
-    else { utils::clear(WDTCSR, WDE); }
+    if (enable) 
+    { 
+        // Enable the watchdog interrupt if a timeout callback is set, the system is then reset
+        // on the next timeout.
+        utils::set(WDTCSR, WDE); 
+        if (nullptr != myTimeoutCallback) { utils::set(WDTCSR, WDIE); }
+        else { utils::clear(WDTCSR, WDIE); }
+    }
+    else { utils::clear(WDTCSR, WDE, WDIE); }
 
     // Re-enable interrupts once the write sequence is complete.
     utils::globalInterruptEnable();
@@ -123,10 +135,22 @@ void Atmega328p::reset() noexcept
     asm("WDR");
     utils::clear(MCUSR, WDRF);
 
+    // Re-arm the watchdog interrupt, since it's disabled by hardware on each timeout. 
+    // The callback is otherwise skipped on the next timeout once the system has recovered.
+    if (myEnabled && (nullptr != myTimeoutCallback)) { utils::set(WDTCSR, WDIE); }
+
     // Re-enable interrupts once the reset process is complete.
     utils::globalInterruptEnable();
 }
 
+// -----------------------------------------------------------------------------
+void Atmega328p::setTimeoutCallback(void (*callback)()) noexcept
+{
+    // Update the callback, then the watchdog mode if enabled.
+    myTimeoutCallback = callback;
+    if (myEnabled) { setEnabled(true); }
+}
+
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p() noexcept
     : myTimeout{}
@@ -158,5 +182,13 @@ bool Atmega328p::setTimeout(const Timeout timeout) noexcept
     myTimeout = timeout;
     return true;
 }
+
+// -----------------------------------------------------------------------------
+ISR (WDT_vect)
+{
+    // The watchdog interrupt is disabled by hardware, so the system is reset on next timeout
+    // unless the watchdog is reset (and the interrupt re-armed) in the meantime.
+    if (nullptr != myTimeoutCallback) { myTimeoutCallback(); }
+}
 } // namespace watchdog
 } // namespace driver
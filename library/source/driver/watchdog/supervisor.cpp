@@ -0,0 +1,118 @@
+/**
+ * @brief Task-aware watchdog supervisor implementation details.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/watchdog/supervisor.h"
+#include "utils/utils.h"
+
+namespace driver 
+{
+namespace watchdog
+{
+// -----------------------------------------------------------------------------
+Supervisor::Supervisor(Interface& watchdog) noexcept
+    : myWatchdog{watchdog}
+    , myDeadline{}
+    , myRemaining{}
+    , myTaskMask{}
+    , myExpiredMask{}
+{}
+
+// -----------------------------------------------------------------------------
+bool Supervisor::isInitialized() const noexcept { return myWatchdog.isInitialized(); }
+
+// -----------------------------------------------------------------------------
+bool Supervisor::isEnabled() const noexcept { return myWatchdog.isEnabled(); }
+
+// -----------------------------------------------------------------------------
+void Supervisor::setEnabled(const bool enable) noexcept { myWatchdog.setEnabled(enable); }
+
+// -----------------------------------------------------------------------------
+uint16_t Supervisor::timeout_ms() const noexcept { return myWatchdog.timeout_ms(); }
+
+// -----------------------------------------------------------------------------
+bool Supervisor::setTimeout_ms(const uint16_t timeout_ms) noexcept 
+{ 
+    return myWatchdog.setTimeout_ms(timeout_ms); 
+}
+
+// -----------------------------------------------------------------------------
+void Supervisor::reset() noexcept
+{
+    // Only reset the watchdog while all supervised tasks are alive.
+    if (0U == myExpiredMask) { myWatchdog.reset(); }
+}
+
+// -----------------------------------------------------------------------------
+void Supervisor::setTimeoutCallback(void (*callback)()) noexcept 
+{ 
+    myWatchdog.setTimeoutCallback(callback); 
+}
+
+// -----------------------------------------------------------------------------
+bool Supervisor::addTask(const uint8_t task, const uint8_t deadline) noexcept
+{
+    // Check the task ID and deadline, return false if invalid.
+    if ((MaxTaskCount <= task) || (0U == deadline)) { return false; }
+
+    // Update the task with interrupts disabled, since ticks may occur in between.
+    // Restore the interrupt state afterwards, since the caller may have disabled interrupts.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    myDeadline[task]  = deadline;
+    myRemaining[task] = deadline;
+    utils::set(myTaskMask, task);
+    utils::clear(myExpiredMask, task);
+    SREG = sreg;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Supervisor::removeTask(const uint8_t task) noexcept
+{
+    if (MaxTaskCount <= task) { return; }
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    utils::clear(myTaskMask, task);
+    utils::clear(myExpiredMask, task);
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+void Supervisor::checkIn(const uint8_t task) noexcept
+{
+    // Restart the deadline, a single byte write is atomic.
+    if (MaxTaskCount > task) { myRemaining[task] = myDeadline[task]; }
+}
+
+// -----------------------------------------------------------------------------
+void Supervisor::tick() noexcept
+{
+    // Count down the deadline of each supervised task, latch the tasks that have expired,
+    // i.e. tasks that didn't check in during the whole deadline.
+    for (uint8_t task{}; task < MaxTaskCount; ++task)
+    {
+        if (!utils::read(myTaskMask, task)) { continue; }
+        if (0U == myRemaining[task]) { utils::set(myExpiredMask, task); }
+        else { myRemaining[task] = myRemaining[task] - 1U; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Supervisor::taskMask() const noexcept { return myTaskMask; }
+
+// -----------------------------------------------------------------------------
+uint8_t Supervisor::expiredMask() const noexcept { return myExpiredMask; }
+
+// -----------------------------------------------------------------------------
+int8_t Supervisor::missedTask() const noexcept
+{
+    // Return the lowest expired task ID, if any.
+    for (uint8_t task{}; task < MaxTaskCount; ++task)
+    {
+        if (utils::read(myExpiredMask, task)) { return static_cast<int8_t>(task); }
+    }
+    return -1;
+}
+} // namespace watchdog
+} // namespace driver
@@ -3,50 +3,361 @@
  */
 #include <stdint.h>
 
+#include "arch/avr/hw_platform.h"
+#include "diag/load.h"
+#include "diag/probe.h"
+#include "diag/stack.h"
+#include "diag/trace.h"
 #include "driver/adc/interface.h"
 #include "driver/eeprom/interface.h"
 #include "driver/gpio/interface.h"
+#include "driver/power/interface.h"
 #include "driver/serial/interface.h"
 #include "driver/tempsensor/interface.h"
 #include "driver/timer/interface.h"
 #include "driver/watchdog/interface.h"
 #include "logic/logic.h"
+#include "utils/utils.h"
 
 namespace logic
 {
+namespace
+{
+/**
+ * @brief Structure of tasks supervised by the watchdog supervisor.
+ */
+struct Task
+{
+    /** EEPROM write queue, alive while drained. */
+    static constexpr uint8_t Eeprom{0U};
+
+    /** Sampling task, alive while the temperature is sampled. */
+    static constexpr uint8_t Sampling{1U};
+};
+
+/** Deadline of each supervised task in supervision periods. */
+constexpr uint8_t TaskDeadline{2U};
+
+/**
+ * @brief Structure of tasks run by the scheduler.
+ */
+struct ScheduledTask
+{
+    /** Supervision task, which advances the task deadlines and the uptime. */
+    static constexpr uint8_t Supervision{0U};
+
+    /** 
+     * Temperature task, which prints the temperature statistics (unless reported on change), 
+     * the CPU load and the memory usage. 
+     */
+    static constexpr uint8_t Temperature{1U};
+
+    /** 
+     * Sampling task, which reads the temperature, updates the statistics and reports the 
+     * temperature on change.
+     */
+    static constexpr uint8_t Sampling{2U};
+};
+
+/** Period of the supervision task in ms. */
+constexpr uint32_t SupervisionPeriod_ms{1000U};
+
+/** Period of the temperature task in ms. */
+constexpr uint32_t TempPeriod_ms{60000U};
+
+/** Period of the sampling task in ms. */
+constexpr uint32_t SamplePeriod_ms{1000U};
+
+// Generate a compiler error if the sampling task can't check in within its deadline.
+static_assert(SamplePeriod_ms < TaskDeadline * SupervisionPeriod_ms, 
+              "Sampling period must be shorter than the supervised task deadline!");
+
+/** Maximal number of samples between temperature reports in report-on-change mode. */
+constexpr uint16_t TempMaxSilence{TempPeriod_ms / SamplePeriod_ms};
+
+/** Deadline of each scheduled task in ms. */
+constexpr uint32_t ScheduledTaskDeadline_ms{100U};
+
+/**
+ * @brief Structure of button states.
+ */
+struct ButtonState
+{
+    /** Ready to handle button presses. */
+    static constexpr uint8_t Ready{0U};
+
+    /** Ignoring button activity to mitigate the effects of contact bounces. */
+    static constexpr uint8_t Debouncing{1U};
+
+    /** The number of button states. */
+    static constexpr uint8_t Count{2U};
+};
+
+/**
+ * @brief Structure of signals dispatched to the button state machine.
+ */
+struct ButtonSignal
+{
+    /** Button activity detected. */
+    static constexpr uint8_t Activity{0U};
+
+    /** Debounce period elapsed. */
+    static constexpr uint8_t DebounceTimeout{1U};
+
+    /** The number of button signals. */
+    static constexpr uint8_t Count{2U};
+};
+
+/**
+ * @brief Structure of LED states.
+ */
+struct LedState
+{
+    /** System operational, parent of the LED modes. */
+    static constexpr uint8_t Operational{0U};
+
+    /** LED disabled. */
+    static constexpr uint8_t Steady{1U};
+
+    /** LED toggled by the toggle timer. */
+    static constexpr uint8_t Blinking{2U};
+
+    /** The number of LED states. */
+    static constexpr uint8_t Count{3U};
+};
+
+/**
+ * @brief Structure of signals dispatched to the LED state machine.
+ */
+struct LedSignal
+{
+    /** Toggle button pressed. */
+    static constexpr uint8_t TogglePressed{0U};
+
+    /** Temperature button pressed. */
+    static constexpr uint8_t TempPressed{1U};
+
+    /** Toggle timer elapsed. */
+    static constexpr uint8_t ToggleTimeout{2U};
+
+    /** The number of LED signals. */
+    static constexpr uint8_t Count{3U};
+};
+} // namespace
+
+/**
+ * @brief Behavior of the logic, expressed as state machine tables and actions.
+ */
+struct Logic::Behavior
+{
+    // -----------------------------------------------------------------------------
+    static void enterDebouncing(Logic& logic) noexcept
+    {
+        // Disable interrupts on the I/O ports to mitigate effects of debouncing.
+        logic.myToggleButtons.forEach<&driver::gpio::Interface::enableInterruptOnPort>(false);
+        logic.myTempButtons.forEach<&driver::gpio::Interface::enableInterruptOnPort>(false);
+        logic.myDebounceTimer.start();
+    }
+
+    // -----------------------------------------------------------------------------
+    static void exitDebouncing(Logic& logic) noexcept
+    {
+        // Re-enable interrupts on the ports after the debounce period.
+        logic.myDebounceTimer.stop();
+        logic.myToggleButtons.forEach<&driver::gpio::Interface::enableInterruptOnPort>(true);
+        logic.myTempButtons.forEach<&driver::gpio::Interface::enableInterruptOnPort>(true);
+    }
+
+    // -----------------------------------------------------------------------------
+    static void readButtons(Logic& logic) noexcept
+    {
+        // Forward the pressed buttons to the LED state machine.
+        if (logic.myToggleButtons.any<&driver::gpio::Interface::read>()) 
+        { 
+            logic.myLedStates.dispatch(LedSignal::TogglePressed); 
+        }
+        if (logic.myTempButtons.any<&driver::gpio::Interface::read>()) 
+        { 
+            logic.myLedStates.dispatch(LedSignal::TempPressed); 
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    static void enterSteady(Logic& logic) noexcept
+    {
+        // Disable the LEDs to ensure that no LED is stuck in an enabled state.
+        logic.myToggleTimer.stop();
+        logic.myLeds.forEach<&driver::gpio::Interface::write>(false);
+    }
+
+    // -----------------------------------------------------------------------------
+    static void enterBlinking(Logic& logic) noexcept { logic.myToggleTimer.start(); }
+
+    // -----------------------------------------------------------------------------
+    static void saveEnabled(Logic& logic) noexcept
+    {
+        // Save the LED state in EEPROM.
+        logic.writeToggleStateToEeprom(true);
+        logic.mySerial.printf("Toggle timer enabled!\n");
+    }
+
+    // -----------------------------------------------------------------------------
+    static void saveDisabled(Logic& logic) noexcept
+    {
+        // Save the LED state in EEPROM.
+        logic.writeToggleStateToEeprom(false);
+        logic.mySerial.printf("Toggle timer disabled!\n");
+    }
+
+    // -----------------------------------------------------------------------------
+    static void toggleLed(Logic& logic) noexcept 
+    { 
+        logic.myLeds.forEach<&driver::gpio::Interface::toggle>(); 
+    }
+
+    // -----------------------------------------------------------------------------
+    static void printTemperature(Logic& logic) noexcept
+    {
+        // Take a fresh sample, print the statistics, then restart the temperature period.
+        logic.sampleTemperature();
+        logic.printTemperature();
+        logic.myScheduler.schedule(ScheduledTask::Temperature, logic.ticks(TempPeriod_ms));
+
+#ifdef DIAG_PROBES
+        // Print the latency statistics on request when the probes are enabled.
+        diag::probe::print(logic.mySerial);
+#endif /** DIAG_PROBES */
+
+#ifdef DIAG_TRACING
+        // Dump the trace on request when tracing is enabled, then start a new trace.
+        diag::trace::print(logic.mySerial);
+        diag::trace::reset();
+#endif /** DIAG_TRACING */
+    }
+
+    /** States of the button state machine, indexed by state ID. */
+    static constexpr fsm::State<Logic> ButtonStates[ButtonState::Count]
+    {
+        {fsm::None, nullptr,         nullptr},        // Ready.
+        {fsm::None, enterDebouncing, exitDebouncing}, // Debouncing.
+    };
+
+    /** Transitions of the button state machine (activity while debouncing is ignored). */
+    static constexpr fsm::Transition<Logic> ButtonTransitions[]
+    {
+        {ButtonState::Ready,      ButtonSignal::Activity,        ButtonState::Debouncing, 
+         nullptr, readButtons},
+        {ButtonState::Debouncing, ButtonSignal::DebounceTimeout, ButtonState::Ready, 
+         nullptr, nullptr},
+    };
+
+    /** States of the LED state machine, indexed by state ID. */
+    static constexpr fsm::State<Logic> LedStates[LedState::Count]
+    {
+        {fsm::None,             nullptr,       nullptr}, // Operational.
+        {LedState::Operational, enterSteady,   nullptr}, // Steady.
+        {LedState::Operational, enterBlinking, nullptr}, // Blinking.
+    };
+
+    /** Transitions of the LED state machine. */
+    static constexpr fsm::Transition<Logic> LedTransitions[]
+    {
+        {LedState::Steady,      LedSignal::TogglePressed, LedState::Blinking, nullptr, saveEnabled},
+        {LedState::Blinking,    LedSignal::TogglePressed, LedState::Steady,   nullptr, saveDisabled},
+        {LedState::Blinking,    LedSignal::ToggleTimeout, fsm::None,          nullptr, toggleLed},
+        {LedState::Operational, LedSignal::TempPressed,   fsm::None,     nullptr, printTemperature},
+    };
+
+    /** Compiled tables of the button state machine. */
+    static constexpr auto ButtonTable{fsm::makeTable<ButtonSignal::Count>(ButtonStates, 
+                                                                         ButtonTransitions)};
+
+    /** Compiled tables of the LED state machine. */
+    static constexpr auto LedTable{fsm::makeTable<LedSignal::Count>(LedStates, LedTransitions)};
+
+    // Generate a compiler error if the state machine tables are invalid.
+    static_assert(ButtonTable.isValid(), "Invalid button state machine!");
+    static_assert(LedTable.isValid(), "Invalid LED state machine!");
+};
+
 // -----------------------------------------------------------------------------
-Logic::Logic(driver::gpio::Interface& led,
-             driver::gpio::Interface& toggleButton,
-             driver::gpio::Interface& tempButton, 
+Logic::Logic(const LedGroup& leds,
+             const ToggleButtonGroup& toggleButtons,
+             const TempButtonGroup& tempButtons, 
              driver::timer::Interface& debounceTimer, 
              driver::timer::Interface& toggleTimer,
-             driver::timer::Interface& tempTimer,
+             driver::timer::Interface& tickTimer,
              driver::serial::Interface& serial, 
              driver::watchdog::Interface& watchdog, 
              driver::eeprom::Interface& eeprom, 
-             driver::tempsensor::Interface& tempSensor) noexcept
-    : myLed{led}
-    , myToggleButton{toggleButton}
-    , myTempButton{tempButton}
+             const TempSensorGroup& tempSensors,
+             driver::power::Interface& power) noexcept
+    : myLeds{leds}
+    , myToggleButtons{toggleButtons}
+    , myTempButtons{tempButtons}
     , myDebounceTimer{debounceTimer}
     , myToggleTimer{toggleTimer}
-    , myTempTimer{tempTimer}
+    , myTickTimer{tickTimer}
     , mySerial{serial}
     , myWatchdog{watchdog}
     , myEeprom{eeprom}
-    , myTempSensor{tempSensor}
+    , myTempSensors{tempSensors}
+    , myPower{power}
+    , myToggleState{eeprom, ToggleStateAddr, ToggleStateRegionSize}
+    , mySupervisor{watchdog}
+    , myCrashLog{eeprom, CrashRecordAddr}
+    , myUptime{}
+    , myLastEvent{Event::None}
+    , myEvents{}
+    , myReportedOverflowCount{}
+    , myScheduler{}
+    , myReportedMissCount{}
+    , myButtonStates{Behavior::ButtonTable, *this}
+    , myLedStates{Behavior::LedTable, *this}
+    , myDeadlineMissReported{false}
 {
+    // Configure when to report the temperature changes of each sensor.
+    for (auto& detector : myTempDetectors)
+    {
+        detector.setConfig({config::TempDeadband, config::TempHysteresis, config::TempRateLimit, 
+                            TempMaxSilence});
+    }
+
     // Enable system if all hardware drivers were initialized correctly.
     if (isInitialized())
     {
-        myToggleButton.enableInterrupt(true);
-        myTempButton.enableInterrupt(true);
-        myTempTimer.start();
+        myToggleButtons.forEach<&driver::gpio::Interface::enableInterrupt>(true);
+        myTempButtons.forEach<&driver::gpio::Interface::enableInterrupt>(true);
+        myTickTimer.start();
         mySerial.setEnabled(true);
         myWatchdog.setEnabled(true);
         myEeprom.setEnabled(true);
+        mySupervisor.addTask(Task::Eeprom, TaskDeadline);
+        mySupervisor.addTask(Task::Sampling, TaskDeadline);
+
+        // Schedule the periodic tasks, the supervision task has the highest priority.
+        // Sample the temperature before reporting, so each report includes the latest sample.
+        const uint16_t deadline{ticks(ScheduledTaskDeadline_ms)};
+        const uint16_t supervisionPeriod{ticks(SupervisionPeriod_ms)};
+        const uint16_t samplePeriod{ticks(SamplePeriod_ms)};
+        const uint16_t tempPeriod{ticks(TempPeriod_ms)};
+        myScheduler.addTask(ScheduledTask::Supervision, {supervisionTask, this, supervisionPeriod, 
+                                                         supervisionPeriod, deadline, 0U});
+        myScheduler.addTask(ScheduledTask::Sampling, {samplingTask, this, samplePeriod, 
+                                                      samplePeriod, deadline, 1U});
+        myScheduler.addTask(ScheduledTask::Temperature, {temperatureTask, this, tempPeriod, 
+                                                         tempPeriod, deadline, 2U});
+
+        // Report the crash context if the system was reset by the watchdog.
+        reportCrash();
 
-        // Enable the toggle timer if it was enabled before poweroff.
+#ifdef DIAG_TRACING
+        // Freeze the trace shortly after the first deadline miss to keep its history.
+        diag::trace::setTrigger(diag::trace::Id::DeadlineMiss, diag::trace::Capacity / 4U);
+#endif /** DIAG_TRACING */
+
+        // Start the state machines, enable the toggle timer if it was enabled before poweroff.
+        myButtonStates.start(ButtonState::Ready);
         restoreToggleStateFromEeprom();
     }
 }
@@ -55,12 +366,12 @@ Logic::Logic(driver::gpio::Interface& led,
 Logic::~Logic() noexcept
 {
     // Disable system.
-    myLed.write(false);
-    myToggleButton.enableInterrupt(false);
-    myTempButton.enableInterrupt(false);
+    myLeds.forEach<&driver::gpio::Interface::write>(false);
+    myToggleButtons.forEach<&driver::gpio::Interface::enableInterrupt>(false);
+    myTempButtons.forEach<&driver::gpio::Interface::enableInterrupt>(false);
     myDebounceTimer.stop();
     myToggleTimer.stop();
-    myTempTimer.stop();
+    myTickTimer.stop();
     mySerial.setEnabled(false);
     myWatchdog.setEnabled(false);
     myEeprom.setEnabled(false);
@@ -71,10 +382,15 @@ Logic::~Logic() noexcept
 bool Logic::isInitialized() const noexcept
 {
     // Return true if all hardware drivers are initialized.
-    return myLed.isInitialized() && myToggleButton.isInitialized() && myTempButton.isInitialized()
+    return myLeds.all<&driver::gpio::Interface::isInitialized>() 
+        && myToggleButtons.all<&driver::gpio::Interface::isInitialized>() 
+        && myTempButtons.all<&driver::gpio::Interface::isInitialized>()
         && myDebounceTimer.isInitialized() && myToggleTimer.isInitialized() 
-        && myTempTimer.isInitialized() && mySerial.isInitialized() && myWatchdog.isInitialized()
-        && myEeprom.isInitialized() && myTempSensor.isInitialized();
+        && myTickTimer.isInitialized() && mySerial.isInitialized() && myWatchdog.isInitialized()
+        && myEeprom.isInitialized() && (EepromUsedSize <= myEeprom.size()) 
+        && myToggleState.isInitialized() 
+        && myTempSensors.all<&driver::tempsensor::Interface::isInitialized>()
+        && myPower.isInitialized();
 }
 
 // -----------------------------------------------------------------------------
@@ -99,108 +415,328 @@ void Logic::run(const bool& stop) noexcept
 
     while (!stop) 
     { 
-        // Regularly reset the watchdog to avoid system reset.
-        myWatchdog.reset(); 
+        // Handle the events posted by the interrupt service routines, then run the tasks 
+        // released by the scheduler.
+        handleEvents();
+        myScheduler.run();
+        reportEventOverflows();
+        reportDeadlineMisses();
+
+        // Reset the watchdog on each wake-up to avoid system reset, as long as all tasks are alive.
+        superviseTasks();
+
+        // Sleep until the next interrupt unless new events were posted in the meantime.
+        // Interrupts are enabled right before entering sleep, so no event is missed.
+        // The sleep time is measured as idle time by the CPU load meter.
+        utils::globalInterruptDisable();
+        if (myEvents.isEmpty() && myScheduler.isIdle()) 
+        { 
+            DIAG_TRACE(diag::trace::Id::Sleep, 0U);
+            diag::load::enterIdle();
+            myPower.sleep(); 
+            diag::load::exitIdle();
+            DIAG_TRACE(diag::trace::Id::Wake, 0U);
+        }
+        else { utils::globalInterruptEnable(); }
     }
 }
 
 // -----------------------------------------------------------------------------
-void Logic::handleButtonEvent() noexcept
-{
-    // Ignore if this call was done manually.
-    if (myDebounceTimer.isEnabled()) { return; }
-    
-    // Disable interrupts on the I/O ports to mitigate effects of debouncing.
-    myToggleButton.enableInterruptOnPort(false);
-    myTempButton.enableInterruptOnPort(false);
-    myDebounceTimer.start();
-
-    // Handle specific button event when pressed.
-    if (myToggleButton.read()) { handleToggleButtonPressed(); }
-    if (myTempButton.read()) { handleTempButtonPressed(); }
+bool Logic::post(const Event event) noexcept 
+{ 
+    // Queue the event, it's handled by the run loop.
+    return myEvents.push(event); 
 }
 
+// -----------------------------------------------------------------------------
+void Logic::handleButtonEvent() noexcept { dispatch(Event::ButtonEvent); }
+
 // -----------------------------------------------------------------------------
 void Logic::handleDebounceTimerTimeout() noexcept
 {
     // Re-enable interrupts on the ports after debounce timer timeout.
-    if (myDebounceTimer.hasTimedOut())
-    {
-        myDebounceTimer.stop();
-        myToggleButton.enableInterruptOnPort(true);
-        myTempButton.enableInterruptOnPort(true);
-    }
+    if (myDebounceTimer.hasTimedOut()) { dispatch(Event::DebounceTimerTimeout); }
 }
 
 // -----------------------------------------------------------------------------
 void Logic::handleToggleTimerTimeout() noexcept 
 {
     // Toggle the LED on toggle timer timeout. 
-    if (myToggleTimer.hasTimedOut()) { myLed.toggle(); }
+    if (myToggleTimer.hasTimedOut()) { dispatch(Event::ToggleTimerTimeout); }
 }
 
 // -----------------------------------------------------------------------------
-void Logic::handleTempTimerTimeout() noexcept 
+void Logic::handleTickTimerTimeout() noexcept 
 { 
-    // Read and print the temperature on temperature timer timeout.
-    if (myTempTimer.hasTimedOut()) { printTemperature(); }
+    // Advance the scheduler on tick timer timeout. Called from interrupt context, so the tick
+    // is also counted while a task is running.
+    if (myTickTimer.hasTimedOut()) 
+    { 
+        DIAG_PROBE(diag::probe::Id::TickTimeout);
+        myScheduler.tick(); 
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::handleWatchdogTimeout() noexcept
+{
+    // Save the crash context, the system is reset on the next watchdog timeout.
+    const diag::CrashLog::Record record{mySupervisor.missedTask(), 
+                                        static_cast<uint8_t>(myLastEvent),
+                                        diag::CrashLog::stackPointer(), 
+                                        myUptime, 
+                                        static_cast<uint8_t>(myEeprom.pendingWrites())};
+    myCrashLog.save(record);
 }
 
 // -----------------------------------------------------------------------------
 void Logic::writeToggleStateToEeprom(const bool enable) noexcept
 { 
-    myEeprom.write(ToggleStateAddr, static_cast<uint8_t>(enable));
+    // Rotate the writes across the toggle state region to spread the EEPROM wear.
+    if (!myToggleState.write(static_cast<uint8_t>(enable)))
+    {
+        mySerial.printf("Failed to save the toggle state in EEPROM!\n");
+    }
 }
 
 // -----------------------------------------------------------------------------
 bool Logic::readToggleStateFromEeprom() const noexcept
 {
     uint8_t state{};
-    return myEeprom.read(ToggleStateAddr, state) ? static_cast<bool>(state) : false;
+    return myToggleState.read(state) ? static_cast<bool>(state) : false;
+}
+
+// -----------------------------------------------------------------------------
+void Logic::sampleTemperature() noexcept
+{
+    // Add a new sample of each sensor to its statistics, which are kept in constant memory.
+    for (uint8_t i{}; i < myTempSensors.size(); ++i) 
+    { 
+        myTempDetectors[i].update(myTempSensors[i]);
+        const int16_t temperature{myTempDetectors[i].temperature()};
+        DIAG_TRACE(diag::trace::Id::Temperature, static_cast<uint16_t>(temperature));
+        myTempStats[i].add(temperature); 
+    }
 }
 
 // -----------------------------------------------------------------------------
 void Logic::printTemperature() noexcept
 {
-    // Read and print the temperature.
-    const int16_t temperature{myTempSensor.read()};
-    mySerial.printf("Temperature: %d Celsius\n", temperature);
+    // Take a sample if none has been taken since the last report.
+    if (0U == myTempStats[0U].count()) { sampleTemperature(); }
+
+    // Print the temperature of each sensor.
+    for (uint8_t i{}; i < myTempSensors.size(); ++i) { printSensorTemperature(i); }
 }
 
 // -----------------------------------------------------------------------------
-void Logic::handleToggleButtonPressed() noexcept
+void Logic::printSensorTemperature(const uint8_t index) noexcept
 {
-    // Toggle the toggle timer on pressdown, safe the current LED state in EEPROM.
-    myToggleTimer.toggle();
-    writeToggleStateToEeprom(myToggleTimer.isEnabled());
+    auto& stats{myTempStats[index]};
+    auto& detector{myTempDetectors[index]};
+
+    // Print the temperature along with the statistics since the last report. Print the latest 
+    // sample in report-on-change mode, so the change triggering the report is visible, 
+    // otherwise the smoothed temperature. Only number the sensors if there are several of them.
+    const int16_t temperature{config::TempReportOnChange ? detector.temperature() : stats.ewma()};
+    if (1U < myTempSensors.size()) { mySerial.printf("Sensor %u: ", index); }
+    mySerial.printf("Temperature: %d Celsius (min: %d, max: %d, mean: %d, std dev: %d)\n", 
+                    temperature, stats.min(), stats.max(), stats.mean(), stats.stdDev());
+
+    // Start a new report window, use the latest sample as reference for the next change.
+    stats.reset();
+    detector.acknowledge();
+}
 
-    if (myToggleTimer.isEnabled()) { mySerial.printf("Toggle timer enabled!\n"); }
-    else
+// -----------------------------------------------------------------------------
+void Logic::reportTemperatureChanges() noexcept
+{
+    // Print the temperature of each sensor with a pending report.
+    for (uint8_t i{}; i < myTempSensors.size(); ++i)
     {
-        // Immediately disable the LED if the toggle timer is disabled to ensure that the LED
-        // isn't stuck in an enabled state.
-        mySerial.printf("Toggle timer disabled!\n");
-        myLed.write(false);
+        if (driver::tempsensor::ChangeDetector::Trigger::None != myTempDetectors[i].pending()) 
+        { 
+            printSensorTemperature(i); 
+        }
     }
 }
 
 // -----------------------------------------------------------------------------
-void Logic::handleTempButtonPressed() noexcept
+void Logic::handleEvents() noexcept
 {
-    // Read and print the temperature on pressdown.
-    // Restart the temperature timer.
-    printTemperature();
-    myTempTimer.restart();
+    // Handle all queued events in thread context, so other interrupts are never masked by
+    // long operations.
+    Event event{};
+    while (myEvents.pop(event)) { dispatch(event); }
 }
 
 // -----------------------------------------------------------------------------
-void Logic::restoreToggleStateFromEeprom() noexcept
+void Logic::dispatch(const Event event) noexcept
+{
+    // The timers only post their timeout event on timeout, so the timeout flags are not
+    // checked again here (they have been cleared by the time the event is handled).
+    myLastEvent = event;
+    DIAG_TRACE(diag::trace::Id::LogicEvent, static_cast<uint16_t>(event));
+
+    switch (event)
+    {
+        case Event::ButtonEvent:
+        {
+            DIAG_PROBE(diag::probe::Id::ButtonEvent);
+            myButtonStates.dispatch(ButtonSignal::Activity);
+            break;
+        }
+        case Event::DebounceTimerTimeout:
+        {
+            DIAG_PROBE(diag::probe::Id::DebounceTimeout);
+            myButtonStates.dispatch(ButtonSignal::DebounceTimeout);
+            break;
+        }
+        case Event::ToggleTimerTimeout:
+        {
+            DIAG_PROBE(diag::probe::Id::ToggleTimeout);
+            myLedStates.dispatch(LedSignal::ToggleTimeout);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::superviseTasks() noexcept
 {
-    // Start the toggle timer if the LED was enabled before poweroff.
-    if (readToggleStateFromEeprom())
+    // Check in the EEPROM task while its write queue is drained.
+    if (0U == myEeprom.pendingWrites()) { mySupervisor.checkIn(Task::Eeprom); }
+
+    // Report the first task that missed its deadline, the watchdog resets the system shortly.
+    if (!myDeadlineMissReported && (0U != mySupervisor.expiredMask()))
     {
-        myToggleTimer.start();
-        mySerial.printf("Toggle timer enabled!\n");
+        mySerial.printf("Task %d missed its deadline!\n", mySupervisor.missedTask());
+        myDeadlineMissReported = true;
     }
+    mySupervisor.reset();
+}
+
+// -----------------------------------------------------------------------------
+void Logic::reportEventOverflows() noexcept
+{
+    // Read the overflow counter atomically, since it's updated from interrupt context.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    const uint16_t overflowCount{myEvents.overflowCount()};
+    SREG = sreg;
+
+    // Report events dropped since the last report, the queue capacity should then be increased.
+    if (myReportedOverflowCount != overflowCount)
+    {
+        mySerial.printf("Event queue overflow! %u events dropped in total.\n", overflowCount);
+        myReportedOverflowCount = overflowCount;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::reportDeadlineMisses() noexcept
+{
+    // Report scheduled tasks that completed too late since the last report.
+    const uint16_t missCount{myScheduler.deadlineMissCount()};
+
+    if (myReportedMissCount != missCount)
+    {
+        DIAG_TRACE(diag::trace::Id::DeadlineMiss, missCount);
+        mySerial.printf("Scheduled task deadline missed! %u misses in total.\n", missCount);
+        myReportedMissCount = missCount;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::reportCpuLoad() noexcept
+{
+    mySerial.printf("CPU load: %u%% (peak: %u%%, ISR: %u%%)\n", diag::load::cpuLoad(), 
+                    diag::load::peakLoad(), diag::load::isrShare());
+}
+
+// -----------------------------------------------------------------------------
+void Logic::reportMemoryUsage() noexcept
+{
+    // The high-water mark only grows, so the worst depth since startup is reported.
+    mySerial.printf("Stack: %u bytes used at most, %u bytes never used.\n", 
+                    diag::stack::maxDepth(), diag::stack::unusedBytes());
+
+#ifdef DIAG_HEAP
+    // Print the heap usage when the heap accounting is enabled.
+    const utils::heap::Stats heap{utils::heap::stats()};
+    mySerial.printf("Heap: %u bytes in %u blocks, %u bytes at most, largest free %u bytes.\n",
+                    static_cast<uint16_t>(heap.liveBytes), heap.liveBlocks, 
+                    static_cast<uint16_t>(heap.peakBytes), 
+                    static_cast<uint16_t>(utils::heap::largestFreeBlock()));
+#endif /** DIAG_HEAP */
+}
+
+// -----------------------------------------------------------------------------
+uint16_t Logic::ticks(const uint32_t duration_ms) const noexcept
+{
+    // Convert the duration to scheduler ticks, use at least one tick.
+    const uint32_t tickPeriod_ms{myTickTimer.timeout_ms()};
+    const uint32_t tickCount{0U < tickPeriod_ms ? duration_ms / tickPeriod_ms : duration_ms};
+    if (0U == tickCount) { return 1U; }
+    return UINT16_MAX < tickCount ? UINT16_MAX : static_cast<uint16_t>(tickCount);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::supervisionTask(void* context) noexcept
+{
+    // Use the supervision task as time base for the supervised task deadlines and as 
+    // measurement window of the CPU load meter.
+    auto& logic{*static_cast<Logic*>(context)};
+    logic.mySupervisor.tick();
+    logic.myUptime = logic.myUptime + 1U;
+    diag::load::update(SupervisionPeriod_ms);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::samplingTask(void* context) noexcept
+{
+    // Sample the temperature periodically, report the changes in report-on-change mode.
+    // Check in with the supervisor once the sample has been taken.
+    auto& logic{*static_cast<Logic*>(context)};
+    logic.sampleTemperature();
+    if (config::TempReportOnChange) { logic.reportTemperatureChanges(); }
+    logic.mySupervisor.checkIn(Task::Sampling);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::temperatureTask(void* context) noexcept
+{
+    // Print the temperature statistics, the CPU load and the memory usage periodically.
+    // The temperature is reported by the sampling task in report-on-change mode.
+    auto& logic{*static_cast<Logic*>(context)};
+    if (!config::TempReportOnChange) { logic.printTemperature(); }
+    logic.reportCpuLoad();
+    logic.reportMemoryUsage();
+}
+
+// -----------------------------------------------------------------------------
+void Logic::reportCrash() noexcept
+{
+    // Print the crash record saved before the last watchdog reset (if any), then clear it.
+    diag::CrashLog::Record record{};
+    if (!myCrashLog.load(record)) { return; }
+
+    mySerial.printf("Watchdog reset! Task: %d, event: %u, SP: 0x%x, uptime: %u, "
+                    "pending EEPROM writes: %u\n", record.task, record.lastEvent, 
+                    record.stackPointer, record.uptime, record.pendingWrites);
+    myCrashLog.clear();
+}
+
+// -----------------------------------------------------------------------------
+void Logic::restoreToggleStateFromEeprom() noexcept
+{
+    // Locate the latest toggle state record, then start the toggle timer if the LED was 
+    // enabled before poweroff.
+    myToggleState.restore();
+    const bool enabled{readToggleStateFromEeprom()};
+    myLedStates.start(enabled ? LedState::Blinking : LedState::Steady);
+    if (enabled) { mySerial.printf("Toggle timer enabled!\n"); }
 }
 } // namespace logic
\ No newline at end of file
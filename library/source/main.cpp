@@ -5,18 +5,23 @@
  *            - A button to toggle a blink timer.
  *            - A button to read the surrounding temperature.
  *            - A blink timer to toggle an LED when enabled.
- *            - A temperature timer to print the temperature on timeout.
+ *            - A tick timer driving a cooperative task scheduler, which samples the temperature 
+ *              and prints the CPU load and the memory usage periodically.
  *            - A debounce timer to reduce the effect of contact bounces after pushing the buttons.
  *            - A serial device to print serial data via UART.
  *            - A watchdog timer to restart the program if it gets stuck somewhere.
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
  *              last stored state before power down was "on," the LED will automatically blink.
  *            - A temperature sensor to read the surrounding temperature.
+ *            - A power management device to put the CPU to sleep between interrupts.
  */
 #include "driver/adc/atmega328p.h"
 #include "driver/eeprom/atmega328p.h"
+#include "driver/eeprom/cache.h"
 #include "driver/gpio/atmega328p.h"
+#include "driver/power/atmega328p.h"
 #include "driver/serial/atmega328p.h"
+#include "driver/tempsensor/kalman.h"
 #include "driver/tempsensor/tmp36.h"
 #include "driver/timer/atmega328p.h"
 #include "driver/watchdog/atmega328p.h"
@@ -36,30 +41,43 @@ namespace callback
 /**
  * @brief Callback for the buttons.
  * 
- *        This callback is invoked when a button event occurs.
+ *        This callback is invoked when a button event occurs. The event is handled by the run
+ *        loop to keep the interrupt service routines short.
  */
-void button() noexcept { myLogic->handleButtonEvent(); }
+void button() noexcept { myLogic->post(logic::Event::ButtonEvent); }
 
 /**
  * @brief Callback for the debounce timer.
  * 
  *        This callback is invoked when the debounce timer times out.
  */
-void debounceTimer() noexcept { myLogic->handleDebounceTimerTimeout(); }
+void debounceTimer() noexcept { myLogic->post(logic::Event::DebounceTimerTimeout); }
 
 /**
  * @brief Callback for the toggle timer.
  * 
  *        This callback is invoked when the toggle timer times out.
  */
-void toggleTimer() noexcept { myLogic->handleToggleTimerTimeout(); }
+void toggleTimer() noexcept { myLogic->post(logic::Event::ToggleTimerTimeout); }
 
 /**
- * @brief Callback for the temperature timer.
+ * @brief Callback for the tick timer.
  * 
- *        This callback is invoked when the temperature timer times out.
+ *        This callback is invoked when the tick timer times out. The scheduler is advanced 
+ *        directly, so ticks are counted while a task runs and never dropped by the event queue.
  */
-void tempTimer() noexcept { myLogic->handleTempTimerTimeout(); }
+void tickTimer() noexcept { myLogic->handleTickTimerTimeout(); }
+
+/**
+ * @brief Callback for the watchdog timer.
+ * 
+ *        This callback is invoked when the watchdog timer times out, right before system reset.
+ */
+void watchdogTimeout() noexcept 
+{ 
+    // The watchdog may time out before the logic implementation has been created.
+    if (nullptr != myLogic) { myLogic->handleWatchdogTimeout(); }
+}
 
 } // namespace callback
 
@@ -105,7 +123,7 @@ int main()
     // Set timeouts.
     constexpr uint32_t debounceTimerTimeout{300U};
     constexpr uint32_t toggleTimerTimeout{100U};
-    constexpr uint32_t tempTimerTimeout{60000U};
+    constexpr uint32_t tickTimerTimeout{10U};
 
     constexpr auto input{gpio::Direction::InputPullup};
     constexpr auto output{gpio::Direction::Output};
@@ -118,7 +136,7 @@ int main()
     // Initialize the timers.
     timer::Atmega328p debounceTimer{debounceTimerTimeout, callback::debounceTimer};
     timer::Atmega328p toggleTimer{toggleTimerTimeout, callback::toggleTimer};
-    timer::Atmega328p tempTimer{tempTimerTimeout, callback::tempTimer};
+    timer::Atmega328p tickTimer{tickTimerTimeout, callback::tickTimer};
 
     // Obtain a reference to the singleton serial device instance.
     auto& serial{serial::Atmega328p::getInstance()};
@@ -126,9 +144,15 @@ int main()
     // Obtain a reference to the singleton watchdog timer instance.
     auto& watchdog{watchdog::Atmega328p::getInstance()};
 
+    // Save the crash context on watchdog timeout before the system is reset.
+    watchdog.setTimeoutCallback(callback::watchdogTimeout);
+
     // Obtain a reference to the singleton EEPROM instance.
     auto& eeprom{eeprom::Atmega328p::getInstance()};
 
+    // Cache the start of the EEPROM, where the logic stores its configuration, in RAM.
+    eeprom::Cache<64U> eepromCache{eeprom, 0U};
+
     // Obtain a reference to the singleton ADC instance.
     auto& adc{adc::Atmega328p::getInstance()};
 
@@ -140,17 +164,37 @@ int main()
 
     //! @todo Replace the TMP36 temperature sensor with a smart sensor.
 
+    // Smooth the noisy TMP36 readings with a Kalman filter.
+    tempsensor::Kalman filteredTempSensor{tempSensor};
+
+    // Obtain a reference to the singleton power management instance.
+    auto& power{power::Atmega328p::getInstance()};
+
+    // Sleep in idle mode between interrupts, since the timers need the I/O clock.
+    power.setSleepMode(power::SleepMode::Idle);
+
+    // Shut off the peripherals the system doesn't use to reduce the active current.
+    power.setPeripheralEnabled(power::Peripheral::Spi, false);
+    power.setPeripheralEnabled(power::Peripheral::Twi, false);
+
+    // Group the devices, the group sizes are set in the logic configuration.
+    const logic::Logic::LedGroup leds{led};
+    const logic::Logic::ToggleButtonGroup toggleButtons{toggleButton};
+    const logic::Logic::TempButtonGroup tempButtons{tempButton};
+    const logic::Logic::TempSensorGroup tempSensors{filteredTempSensor};
+
     // Initialize the logic implementation with the given hardware.
-    logic::Logic logic{led, 
-                       toggleButton, 
-                       tempButton, 
+    logic::Logic logic{leds, 
+                       toggleButtons, 
+                       tempButtons, 
                        debounceTimer, 
                        toggleTimer, 
-                       tempTimer,
+                       tickTimer,
                        serial, 
                        watchdog, 
-                       eeprom, 
-                       tempSensor};
+                       eepromCache, 
+                       tempSensors,
+                       power};
     myLogic = &logic;
 
     // Run the application on the target MCU.
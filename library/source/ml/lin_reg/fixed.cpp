@@ -27,6 +27,7 @@ constexpr bool isLearningRateValid(const double learningRate) noexcept
 Fixed::Fixed() noexcept
     : myWeight{}
     , myBias{}
+    , myRevision{}
     , myTrained{false}
 {}
 
@@ -36,6 +37,9 @@ bool Fixed::isTrained() const noexcept { return myTrained; }
 // -----------------------------------------------------------------------------
 double Fixed::predict(const double input) const noexcept { return myWeight * input + myBias; }
 
+// -----------------------------------------------------------------------------
+uint16_t Fixed::revision() const noexcept { return myRevision; }
+
 // -----------------------------------------------------------------------------
 bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_t epochCount, 
                    const double learningRate) noexcept
@@ -60,7 +64,8 @@ bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_
             optimize(trainIn[i], trainOut[i], learningRate);
         }
     }
-    // Return true to indicate success.
+    // Bump the revision to indicate that the parameters have changed, return true on success.
+    ++myRevision;
     myTrained = true;
     return myTrained;
 }
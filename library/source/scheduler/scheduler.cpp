@@ -0,0 +1,181 @@
+/**
+ * @brief Cooperative run-to-completion task scheduler implementation details.
+ */
+#include "arch/avr/hw_platform.h"
+#include "diag/probe.h"
+#include "diag/trace.h"
+#include "scheduler/scheduler.h"
+#include "utils/utils.h"
+
+namespace scheduler
+{
+// -----------------------------------------------------------------------------
+Scheduler::Scheduler() noexcept
+    : myTasks{}
+    , myRemaining{}
+    , myReleaseTick{}
+    , myMissCount{}
+    , myTickCount{}
+    , myPendingTicks{}
+    , myTaskMask{}
+    , myArmedMask{}
+    , myReadyMask{}
+{}
+
+// -----------------------------------------------------------------------------
+bool Scheduler::addTask(const uint8_t id, const Task& task) noexcept
+{
+    // Check the task ID and task function, return false if invalid.
+    if ((MaxTaskCount <= id) || (nullptr == task.callback)) { return false; }
+
+    myTasks[id]     = task;
+    myMissCount[id] = 0U;
+    utils::set(myTaskMask, id);
+    utils::clear(myReadyMask, id);
+    return schedule(id, task.delay);
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::removeTask(const uint8_t id) noexcept
+{
+    if (MaxTaskCount <= id) { return; }
+    utils::clear(myTaskMask, id);
+    utils::clear(myArmedMask, id);
+    utils::clear(myReadyMask, id);
+}
+
+// -----------------------------------------------------------------------------
+bool Scheduler::schedule(const uint8_t id, const uint16_t delay) noexcept
+{
+    if ((MaxTaskCount <= id) || !utils::read(myTaskMask, id)) { return false; }
+
+    // Release the task immediately if no delay is specified, otherwise arm it.
+    if (0U == delay) { release(id); }
+    else
+    {
+        myRemaining[id] = delay;
+        utils::set(myArmedMask, id);
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::tick() noexcept
+{
+    // Saturate rather than wrap around, if the ticks aren't processed in time.
+    if (UINT8_MAX > myPendingTicks) { myPendingTicks = myPendingTicks + 1U; }
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Scheduler::run() noexcept
+{
+    uint8_t runCount{};
+    processTicks();
+
+    // Run the released tasks to completion, highest priority first. Process the ticks 
+    // elapsed during each task, so a task with higher priority released meanwhile runs next.
+    for (int8_t id{nextTask()}; 0 <= id; id = nextTask())
+    {
+        const Task& task{myTasks[id]};
+        utils::clear(myReadyMask, static_cast<uint8_t>(id));
+        {
+            DIAG_PROBE(diag::probe::Id::ScheduledTasks);
+            DIAG_TRACE(diag::trace::Id::TaskStart, static_cast<uint16_t>(id));
+            task.callback(task.context);
+            DIAG_TRACE(diag::trace::Id::TaskEnd, static_cast<uint16_t>(id));
+        }
+        processTicks();
+
+        // Count a deadline miss if the task completed too late.
+        const uint16_t responseTime{static_cast<uint16_t>(myTickCount - myReleaseTick[id])};
+        if ((0U != task.deadline) && (task.deadline < responseTime)) { myMissCount[id]++; }
+        runCount++;
+    }
+    return runCount;
+}
+
+// -----------------------------------------------------------------------------
+bool Scheduler::isIdle() const noexcept { return 0U == myPendingTicks; }
+
+// -----------------------------------------------------------------------------
+uint16_t Scheduler::tickCount() const noexcept { return myTickCount; }
+
+// -----------------------------------------------------------------------------
+uint8_t Scheduler::taskMask() const noexcept { return myTaskMask; }
+
+// -----------------------------------------------------------------------------
+uint16_t Scheduler::deadlineMissCount(const uint8_t id) const noexcept
+{
+    return MaxTaskCount > id ? myMissCount[id] : 0U;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t Scheduler::deadlineMissCount() const noexcept
+{
+    uint16_t missCount{};
+    for (uint8_t id{}; id < MaxTaskCount; ++id) { missCount += myMissCount[id]; }
+    return missCount;
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::processTicks() noexcept
+{
+    // Fetch the accumulated ticks with interrupts disabled, since ticks may occur in between.
+    // Restore the interrupt state afterwards, since the caller may have disabled interrupts.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    uint8_t tickCount{myPendingTicks};
+    myPendingTicks = 0U;
+    SREG = sreg;
+
+    // Count down the armed tasks one tick at a time, release the tasks that are due.
+    while (0U < tickCount--)
+    {
+        myTickCount++;
+
+        for (uint8_t id{}; id < MaxTaskCount; ++id)
+        {
+            if (!utils::read(myArmedMask, id)) { continue; }
+            if (0U == --myRemaining[id]) { release(id); }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Scheduler::release(const uint8_t id) noexcept
+{
+    // Count a deadline miss if the previous release hasn't run yet (the releases are merged).
+    if (utils::read(myReadyMask, id)) { myMissCount[id]++; }
+    else
+    {
+        utils::set(myReadyMask, id);
+        myReleaseTick[id] = myTickCount;
+    }
+
+    // Re-arm periodic tasks, one-shot tasks stay disarmed until scheduled again.
+    const uint16_t period{myTasks[id].period};
+    if (0U != period) 
+    { 
+        myRemaining[id] = period;
+        utils::set(myArmedMask, id);
+    }
+    else { utils::clear(myArmedMask, id); }
+}
+
+// -----------------------------------------------------------------------------
+int8_t Scheduler::nextTask() const noexcept
+{
+    // Return the released task with the highest priority, or -1 if no task is released.
+    int8_t next{-1};
+
+    for (uint8_t id{}; id < MaxTaskCount; ++id)
+    {
+        if (!utils::read(myReadyMask, id)) { continue; }
+        if ((0 > next) || (myTasks[id].priority < myTasks[next].priority))
+        {
+            next = static_cast<int8_t>(id);
+        }
+    }
+    return next;
+}
+} // namespace scheduler
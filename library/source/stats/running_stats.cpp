@@ -0,0 +1,176 @@
+/**
+ * @brief Streaming statistics implementation details.
+ */
+#include <stdint.h>
+
+#include "stats/running_stats.h"
+
+namespace stats
+{
+namespace
+{
+/** Value of 1 in fixed-point format. */
+constexpr int32_t Scale{1L << RunningStats::Shift};
+
+/** Maximal deviation from the mean in fixed-point format, which keeps products in 32 bits. */
+constexpr int32_t MaxDeviation{127L * Scale};
+
+// -----------------------------------------------------------------------------
+constexpr uint8_t ewmaShift(const uint8_t shift) noexcept
+{
+    return RunningStats::MaxEwmaShift >= shift ? shift : RunningStats::DefaultEwmaShift;
+}
+
+// -----------------------------------------------------------------------------
+constexpr int32_t divide(const int32_t numerator, const int32_t denominator) noexcept
+{
+    // Round to the nearest integer, halfway cases away from zero.
+    const int32_t rounding{denominator / 2};
+    return 0 <= numerator ? (numerator + rounding) / denominator 
+                          : (numerator - rounding) / denominator;
+}
+
+// -----------------------------------------------------------------------------
+constexpr int32_t limit(const int32_t value) noexcept
+{
+    return MaxDeviation < value ? MaxDeviation : (-MaxDeviation > value ? -MaxDeviation : value);
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t saturatedSum(const uint32_t x, const uint32_t y) noexcept
+{
+    return UINT32_MAX - x < y ? UINT32_MAX : x + y;
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t squareRoot(uint32_t value) noexcept
+{
+    // Compute the integer square root bit by bit, rounded down.
+    uint32_t root{};
+    uint32_t bit{1UL << 30U};
+
+    while (bit > value) { bit >>= 2U; }
+    while (0U != bit)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1U) + bit;
+        }
+        else { root >>= 1U; }
+        bit >>= 2U;
+    }
+    return root;
+}
+
+// -----------------------------------------------------------------------------
+constexpr int16_t toInteger(const int32_t value) noexcept
+{
+    return static_cast<int16_t>(divide(value, Scale));
+}
+
+// Verify the fixed-point arithmetic.
+static_assert(3 == toInteger(640) && -3 == toInteger(-640), "Fixed-point rounding failed!");
+static_assert(0U == squareRoot(0U) && 12U == squareRoot(168U) && 65535U == squareRoot(UINT32_MAX),
+    "Integer square root failed!");
+} // namespace
+
+// -----------------------------------------------------------------------------
+RunningStats::RunningStats(const uint8_t ewmaShift) noexcept
+    : myMean{}
+    , mySumSquares{}
+    , myEwma{}
+    , myMin{}
+    , myMax{}
+    , myCount{}
+    , myEwmaShift{stats::ewmaShift(ewmaShift)}
+    , myEwmaInitialized{false}
+{}
+
+// -----------------------------------------------------------------------------
+void RunningStats::add(const int16_t sample) noexcept
+{
+    // Update the EWMA first, it keeps running after the counter saturates.
+    const int32_t value{static_cast<int32_t>(sample) * Scale};
+    updateEwma(value);
+
+    // Stop accumulating once the counter saturates, the statistics are stable by then.
+    if (UINT16_MAX == myCount) { return; }
+    myCount++;
+
+    // Update the mean and the sum of squared differences (Welford's algorithm). The product 
+    // of the deviations before and after updating the mean is never negative.
+    const int32_t delta{value - myMean};
+    myMean += divide(delta, myCount);
+    const int32_t product{limit(delta) * limit(value - myMean)};
+    if (0 < product) 
+    { 
+        mySumSquares = saturatedSum(mySumSquares, static_cast<uint32_t>(divide(product, Scale))); 
+    }
+
+    // Update the extremes.
+    if ((1U == myCount) || (sample < myMin)) { myMin = sample; }
+    if ((1U == myCount) || (sample > myMax)) { myMax = sample; }
+}
+
+// -----------------------------------------------------------------------------
+void RunningStats::reset() noexcept
+{
+    myMean       = 0;
+    mySumSquares = 0U;
+    myMin        = 0;
+    myMax        = 0;
+    myCount      = 0U;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t RunningStats::count() const noexcept { return myCount; }
+
+// -----------------------------------------------------------------------------
+int16_t RunningStats::mean() const noexcept { return toInteger(myMean); }
+
+// -----------------------------------------------------------------------------
+int32_t RunningStats::mean_q8() const noexcept { return myMean; }
+
+// -----------------------------------------------------------------------------
+uint32_t RunningStats::variance_q8() const noexcept 
+{ 
+    // Saturate the rounding term, since the sum of squares may already be saturated.
+    return 1U < myCount ? saturatedSum(mySumSquares, (myCount - 1U) / 2U) / (myCount - 1U) : 0U; 
+}
+
+// -----------------------------------------------------------------------------
+int16_t RunningStats::stdDev() const noexcept 
+{ 
+    return toInteger(static_cast<int32_t>(stdDev_q8())); 
+}
+
+// -----------------------------------------------------------------------------
+uint32_t RunningStats::stdDev_q8() const noexcept 
+{ 
+    // sqrt(v * 2^8) * 2^4 = sqrt(v) * 2^8, scale before the square root while it fits.
+    const uint32_t variance{variance_q8()};
+    return (UINT32_MAX >> Shift) >= variance ? squareRoot(variance << Shift) 
+                                             : squareRoot(variance) << (Shift / 2U);
+}
+
+// -----------------------------------------------------------------------------
+int16_t RunningStats::min() const noexcept { return myMin; }
+
+// -----------------------------------------------------------------------------
+int16_t RunningStats::max() const noexcept { return myMax; }
+
+// -----------------------------------------------------------------------------
+int16_t RunningStats::ewma() const noexcept { return toInteger(myEwma); }
+
+// -----------------------------------------------------------------------------
+int32_t RunningStats::ewma_q8() const noexcept { return myEwma; }
+
+// -----------------------------------------------------------------------------
+void RunningStats::updateEwma(const int32_t sample) noexcept
+{
+    // Initialize the EWMA with the first sample ever added.
+    myEwma = myEwmaInitialized ? myEwma + divide(sample - myEwma, 1L << myEwmaShift) : sample;
+    myEwmaInitialized = true;
+}
+} // namespace stats
@@ -0,0 +1,194 @@
+/**
+ * @brief Heap accounting implementation details.
+ */
+#include <stdlib.h>
+
+#include "arch/avr/hw_platform.h"
+#include "utils/heap.h"
+
+#ifndef TESTSUITE
+
+/**
+ * @brief Structure of free list entries (provided by avr-libc).
+ */
+struct __freelist
+{
+    /** Size of the free block. */
+    size_t sz;
+
+    /** Pointer to the next free block. */
+    __freelist* nx;
+};
+
+/** Head of the free list (provided by avr-libc). */
+extern __freelist* __flp;
+
+/** Current end of the heap, nullptr if nothing has been allocated (provided by avr-libc). */
+extern char* __brkval;
+
+/** Start of the heap (provided by the linker). */
+extern char __heap_start;
+
+/** Safety margin between the heap and the stack (provided by avr-libc). */
+extern size_t __malloc_margin;
+
+#endif /** TESTSUITE */
+
+namespace utils
+{
+namespace heap
+{
+namespace
+{
+/**
+ * @brief Structure of block headers, aligned so the payload keeps the malloc alignment.
+ */
+struct alignas(alignof(max_align_t)) Header
+{
+    /** The block size in bytes, excluding the header. */
+    size_t size;
+};
+
+/** Heap statistics. */
+Stats myStats{};
+
+/** Statistics of the tracked call sites. */
+Site mySites[MaxSiteCount]{};
+
+/** The number of tracked call sites. */
+uint8_t mySiteCount{};
+
+// -----------------------------------------------------------------------------
+void* payload(Header* header) noexcept { return header + 1U; }
+
+// -----------------------------------------------------------------------------
+Header* header(void* block) noexcept { return static_cast<Header*>(block) - 1U; }
+
+// -----------------------------------------------------------------------------
+void countSite(const void* address) noexcept
+{
+    // Count the call site if already tracked, otherwise track it if space remains.
+    for (uint8_t i{}; i < mySiteCount; ++i)
+    {
+        if (address == mySites[i].address) 
+        { 
+            mySites[i].count++; 
+            return;
+        }
+    }
+    if (MaxSiteCount > mySiteCount) { mySites[mySiteCount++] = Site{address, 1U}; }
+    else { myStats.untrackedCount++; }
+}
+
+// -----------------------------------------------------------------------------
+void addLiveBytes(const size_t size) noexcept
+{
+    myStats.liveBytes += size;
+    if (myStats.liveBytes > myStats.peakBytes) { myStats.peakBytes = myStats.liveBytes; }
+}
+
+// -----------------------------------------------------------------------------
+void* allocateAt(const size_t size, const void* site) noexcept
+{
+    auto header{static_cast<Header*>(malloc(sizeof(Header) + size))};
+    if (nullptr == header) 
+    { 
+        myStats.failedCount++;
+        return nullptr; 
+    }
+    header->size = size;
+    addLiveBytes(size);
+    myStats.liveBlocks++;
+    myStats.allocCount++;
+    countSite(site);
+    return payload(header);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+__attribute__((noinline)) void* allocate(const size_t size) noexcept
+{
+    // The caller is the always inlined utils::newMemory, i.e. the actual call site.
+    return allocateAt(size, __builtin_return_address(0));
+}
+
+// -----------------------------------------------------------------------------
+__attribute__((noinline)) void* reallocate(void* block, const size_t size) noexcept
+{
+    // The caller is the always inlined utils::reallocMemory, i.e. the actual call site.
+    if (nullptr == block) { return allocateAt(size, __builtin_return_address(0)); }
+
+    // Reallocate including the header, the block is left untouched on failure.
+    const size_t oldSize{header(block)->size};
+    auto newHeader{static_cast<Header*>(realloc(header(block), sizeof(Header) + size))};
+    if (nullptr == newHeader) 
+    { 
+        myStats.failedCount++;
+        return nullptr; 
+    }
+    newHeader->size    = size;
+    myStats.liveBytes -= oldSize;
+    addLiveBytes(size);
+    myStats.reallocCount++;
+    countSite(__builtin_return_address(0));
+    return payload(newHeader);
+}
+
+// -----------------------------------------------------------------------------
+void release(void* block) noexcept
+{
+    if (nullptr == block) { return; }
+    myStats.liveBytes -= header(block)->size;
+    myStats.liveBlocks--;
+    myStats.freeCount++;
+    free(header(block));
+}
+
+// -----------------------------------------------------------------------------
+Stats stats() noexcept { return myStats; }
+
+// -----------------------------------------------------------------------------
+uint8_t siteCount() noexcept { return mySiteCount; }
+
+// -----------------------------------------------------------------------------
+bool site(const uint8_t index, Site& site) noexcept
+{
+    if (mySiteCount <= index) { return false; }
+    site = mySites[index];
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+size_t largestFreeBlock() noexcept
+{
+#ifndef TESTSUITE
+    // Check the space between the heap and the stack, keeping the malloc safety margin.
+    const char* heapEnd{nullptr != __brkval ? __brkval : &__heap_start};
+    const char* stackLimit{reinterpret_cast<const char*>(SP) - __malloc_margin};
+    size_t largest{stackLimit > heapEnd ? static_cast<size_t>(stackLimit - heapEnd) : 0U};
+
+    // Check the blocks in the free list, which remain when blocks are freed out of order.
+    for (const __freelist* block{__flp}; nullptr != block; block = block->nx)
+    {
+        if (block->sz > largest) { largest = block->sz; }
+    }
+    return largest;
+#else
+    return 0U;
+#endif /** TESTSUITE */
+}
+
+// -----------------------------------------------------------------------------
+void reset() noexcept
+{
+    // Keep the live usage, since the allocated blocks are still accounted for.
+    const size_t liveBytes{myStats.liveBytes};
+    const uint16_t liveBlocks{myStats.liveBlocks};
+    myStats            = Stats{};
+    myStats.liveBytes  = liveBytes;
+    myStats.peakBytes  = liveBytes;
+    myStats.liveBlocks = liveBlocks;
+    mySiteCount        = 0U;
+}
+} // namespace heap
+} // namespace utils
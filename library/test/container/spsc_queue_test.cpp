@@ -0,0 +1,162 @@
+/**
+ * @brief Unit tests for the lock-free single-producer/single-consumer queue.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/spsc_queue.h"
+
+#ifdef TESTSUITE
+
+namespace container
+{
+namespace
+{
+/**
+ * @brief Push/pop test.
+ *
+ *        Verify that values are popped in the same order as they were pushed.
+ */
+TEST(Container_SpscQueue, PushPop)
+{
+    SpscQueue<std::uint8_t, 4U> queue{};
+
+    // Case 1 - Verify that the queue is empty at the start.
+    {
+        std::uint8_t value{};
+        EXPECT_EQ(queue.capacity(), 4U);
+        EXPECT_EQ(queue.size(), 0U);
+        EXPECT_TRUE(queue.isEmpty());
+        EXPECT_FALSE(queue.isFull());
+        EXPECT_FALSE(queue.pop(value));
+    }
+
+    // Case 2 - Push three values, expect them to be popped in the same order.
+    {
+        EXPECT_TRUE(queue.push(10U));
+        EXPECT_TRUE(queue.push(20U));
+        EXPECT_TRUE(queue.push(30U));
+        EXPECT_EQ(queue.size(), 3U);
+
+        for (std::uint8_t expected{10U}; expected <= 30U; expected += 10U)
+        {
+            std::uint8_t value{};
+            EXPECT_TRUE(queue.pop(value));
+            EXPECT_EQ(value, expected);
+        }
+        EXPECT_TRUE(queue.isEmpty());
+    }
+
+    // Case 3 - Interleave pushes and pops, expect the order to be preserved.
+    {
+        std::uint8_t value{};
+        EXPECT_TRUE(queue.push(1U));
+        EXPECT_TRUE(queue.push(2U));
+        EXPECT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, 1U);
+        EXPECT_TRUE(queue.push(3U));
+        EXPECT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, 2U);
+        EXPECT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, 3U);
+        EXPECT_FALSE(queue.pop(value));
+        EXPECT_EQ(queue.overflowCount(), 0U);
+    }
+}
+
+/**
+ * @brief Overflow test.
+ *
+ *        Verify that values pushed to a full queue are dropped and counted.
+ */
+TEST(Container_SpscQueue, Overflow)
+{
+    SpscQueue<std::uint8_t, 4U> queue{};
+
+    // Case 1 - Fill the queue, expect it to be full without any overflows.
+    {
+        for (std::uint8_t i{}; i < queue.capacity(); ++i) { EXPECT_TRUE(queue.push(i)); }
+        EXPECT_TRUE(queue.isFull());
+        EXPECT_EQ(queue.size(), queue.capacity());
+        EXPECT_EQ(queue.overflowCount(), 0U);
+    }
+
+    // Case 2 - Push three more values, expect them to be dropped and counted as overflows.
+    {
+        EXPECT_FALSE(queue.push(100U));
+        EXPECT_FALSE(queue.push(101U));
+        EXPECT_FALSE(queue.push(102U));
+        EXPECT_EQ(queue.size(), queue.capacity());
+        EXPECT_EQ(queue.overflowCount(), 3U);
+    }
+
+    // Case 3 - Pop all values, expect the original values only, i.e. no dropped value.
+    {
+        for (std::uint8_t i{}; i < queue.capacity(); ++i)
+        {
+            std::uint8_t value{};
+            EXPECT_TRUE(queue.pop(value));
+            EXPECT_EQ(value, i);
+        }
+        EXPECT_TRUE(queue.isEmpty());
+    }
+
+    // Case 4 - Push a value once there's room again, expect it to be accepted.
+    // Expect the overflow count to be kept.
+    {
+        std::uint8_t value{};
+        EXPECT_TRUE(queue.push(200U));
+        EXPECT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, 200U);
+        EXPECT_EQ(queue.overflowCount(), 3U);
+    }
+}
+
+/**
+ * @brief Wraparound test.
+ *
+ *        Verify that the queue keeps working when its free-running positions wrap around.
+ */
+TEST(Container_SpscQueue, Wraparound)
+{
+    SpscQueue<std::uint16_t, 8U> queue{};
+    std::uint16_t next{};
+    std::uint16_t expected{};
+
+    // Case 1 - Push and pop values until the 8-bit positions have wrapped around several
+    // times, keep the queue partially filled.
+    // Expect the values to be popped in order and the size to stay consistent.
+    {
+        for (std::uint8_t i{}; i < 5U; ++i) { EXPECT_TRUE(queue.push(next++)); }
+
+        for (std::uint16_t i{}; i < 1000U; ++i)
+        {
+            std::uint16_t value{};
+            EXPECT_TRUE(queue.push(next++));
+            EXPECT_TRUE(queue.pop(value));
+            EXPECT_EQ(value, expected++);
+            EXPECT_EQ(queue.size(), 5U);
+        }
+    }
+
+    // Case 2 - Fill the queue after the wraparound, expect it to hold exactly its capacity.
+    {
+        while (!queue.isFull()) { EXPECT_TRUE(queue.push(next++)); }
+        EXPECT_EQ(queue.size(), queue.capacity());
+        EXPECT_FALSE(queue.push(next));
+        EXPECT_EQ(queue.overflowCount(), 1U);
+    }
+
+    // Case 3 - Drain the queue, expect the remaining values in order.
+    {
+        std::uint16_t value{};
+        while (queue.pop(value)) { EXPECT_EQ(value, expected++); }
+        EXPECT_EQ(expected, next);
+        EXPECT_TRUE(queue.isEmpty());
+    }
+}
+} // namespace
+} // namespace container
+
+#endif /** TESTSUITE */
@@ -0,0 +1,76 @@
+/**
+ * @brief Unit tests for the crash log.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "diag/crash_log.h"
+#include "driver/eeprom/stub.h"
+
+#ifdef TESTSUITE
+
+namespace diag
+{
+namespace
+{
+/** EEPROM size in bytes. */
+constexpr std::uint16_t EepromSize{32U};
+
+/** Address of the crash record slot. */
+constexpr std::uint16_t SlotAddr{8U};
+
+/**
+ * @brief Crash log test.
+ * 
+ *        Verify that crash records are saved, loaded and cleared correctly.
+ */
+TEST(Diag_CrashLog, SaveLoad)
+{
+    driver::eeprom::Stub<EepromSize> eeprom{};
+    CrashLog crashLog{eeprom, SlotAddr};
+    CrashLog::Record record{};
+
+    // Case 1 - Expect no record to be loaded from erased EEPROM.
+    {
+        for (std::uint16_t i{}; i < CrashLog::SlotSize; ++i) 
+        { 
+            eeprom.write(SlotAddr + i, static_cast<std::uint8_t>(0xFFU)); 
+        }
+        EXPECT_FALSE(crashLog.load(record));
+    }
+
+    // Case 2 - Save a record, expect it to be loaded after a restart.
+    {
+        SP = 0x08F0U;
+        const CrashLog::Record saved{3, 4U, CrashLog::stackPointer(), 1234U, 2U};
+        EXPECT_EQ(saved.stackPointer, 0x08F0U);
+        EXPECT_TRUE(crashLog.save(saved));
+
+        CrashLog restarted{eeprom, SlotAddr};
+        EXPECT_TRUE(restarted.load(record));
+        EXPECT_EQ(record.task, saved.task);
+        EXPECT_EQ(record.lastEvent, saved.lastEvent);
+        EXPECT_EQ(record.stackPointer, saved.stackPointer);
+        EXPECT_EQ(record.uptime, saved.uptime);
+        EXPECT_EQ(record.pendingWrites, saved.pendingWrites);
+    }
+
+    // Case 3 - Clear the record, expect no record to be loaded.
+    // Expect the bytes outside the slot to be untouched.
+    {
+        EXPECT_TRUE(crashLog.clear());
+        EXPECT_FALSE(crashLog.load(record));
+
+        std::uint8_t outside{};
+        EXPECT_TRUE(eeprom.read(SlotAddr - 1U, outside));
+        EXPECT_EQ(outside, 0U);
+        EXPECT_TRUE(eeprom.read(SlotAddr + CrashLog::SlotSize, outside));
+        EXPECT_EQ(outside, 0U);
+    }
+}
+} // namespace
+} // namespace diag
+
+#endif /** TESTSUITE */
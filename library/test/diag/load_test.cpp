@@ -0,0 +1,73 @@
+/**
+ * @brief Unit tests for the CPU load meter.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "diag/load.h"
+
+#ifdef TESTSUITE
+
+namespace diag
+{
+namespace
+{
+/**
+ * @brief CPU load meter test.
+ * 
+ *        Verify that the CPU load is derived from the idle time and the interrupt time.
+ */
+TEST(Diag_Load, CpuLoad)
+{
+    // The time base runs at 2 MHz, so a 1 ms window corresponds to 2000 counts.
+    constexpr std::uint16_t window_ms{1U};
+
+    // Case 1 - Sleep for 1000 counts, including 100 counts spent in an interrupt.
+    {
+        TCNT1 = 0U;
+        load::enterIdle();
+        TCNT1 = 200U;
+        {
+            const load::IsrScope isr{};
+            TCNT1 = 300U;
+        }
+        TCNT1 = 1000U;
+        load::exitIdle();
+        load::update(window_ms);
+
+        // Expect 900 idle counts out of 2000, i.e. 55 % load of which 5 % in interrupts.
+        EXPECT_EQ(load::cpuLoad(), 55U);
+        EXPECT_EQ(load::isrShare(), 5U);
+        EXPECT_EQ(load::peakLoad(), 55U);
+    }
+
+    // Case 2 - Don't sleep at all, expect full load.
+    {
+        load::update(window_ms);
+        EXPECT_EQ(load::cpuLoad(), 100U);
+        EXPECT_EQ(load::isrShare(), 0U);
+        EXPECT_EQ(load::peakLoad(), 100U);
+    }
+
+    // Case 3 - Sleep the entire window, expect no load while the peak load is kept.
+    {
+        TCNT1 = 0xF000U;
+        load::enterIdle();
+        TCNT1 = 0xF000U + 2000U;
+        load::exitIdle();
+        load::update(window_ms);
+
+        EXPECT_EQ(load::cpuLoad(), 0U);
+        EXPECT_EQ(load::peakLoad(), 100U);
+
+        // Reset the peak load, expect it to match the current load.
+        load::resetPeak();
+        EXPECT_EQ(load::peakLoad(), 0U);
+    }
+}
+} // namespace
+} // namespace diag
+
+#endif /** TESTSUITE */
@@ -0,0 +1,84 @@
+/**
+ * @brief Unit tests for the latency probes.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "diag/probe.h"
+
+#ifdef TESTSUITE
+
+namespace diag
+{
+namespace
+{
+/**
+ * @brief Latency probe test.
+ * 
+ *        Verify that the measured durations are recorded in the probe statistics.
+ */
+TEST(Diag_Probe, Statistics)
+{
+    constexpr std::uint8_t id{probe::Id::ButtonEvent};
+    probe::reset();
+
+    // Case 1 - Verify that invalid probe IDs are rejected.
+    {
+        probe::Stats stats{};
+        EXPECT_FALSE(probe::stats(probe::Id::Count, stats));
+        EXPECT_TRUE(probe::stats(id, stats));
+        EXPECT_EQ(stats.count, 0U);
+    }
+
+    // Case 2 - Measure a duration of 10 counts (5 us) with a scoped probe.
+    {
+        TCNT1 = 1000U;
+        {
+            const probe::Scope scope{id};
+            TCNT1 = 1010U;
+        }
+        probe::Stats stats{};
+        EXPECT_TRUE(probe::stats(id, stats));
+        EXPECT_EQ(stats.count, 1U);
+        EXPECT_EQ(stats.min, 10U);
+        EXPECT_EQ(stats.max, 10U);
+        EXPECT_EQ(probe::toMicroseconds(stats.sum / stats.count), 5U);
+
+        // Expect the duration to be placed in the second bucket (4-8 us).
+        EXPECT_EQ(stats.histogram[1U], 1U);
+    }
+
+    // Case 3 - Measure a duration across the time base wraparound, then a very long duration.
+    {
+        TCNT1 = 0xFFF0U;
+        {
+            const probe::Scope scope{id};
+            TCNT1 = 0x0002U;
+        }
+        probe::record(id, 1000U);
+
+        probe::Stats stats{};
+        EXPECT_TRUE(probe::stats(id, stats));
+        EXPECT_EQ(stats.count, 3U);
+        EXPECT_EQ(stats.min, 10U);
+        EXPECT_EQ(stats.max, 1000U);
+        EXPECT_EQ(stats.sum, 10U + 18U + 1000U);
+        EXPECT_EQ(stats.histogram[2U], 1U);
+        EXPECT_EQ(stats.histogram[probe::BucketCount - 1U], 1U);
+    }
+
+    // Case 4 - Reset the statistics, expect all probes to be cleared.
+    {
+        probe::reset();
+        probe::Stats stats{};
+        EXPECT_TRUE(probe::stats(id, stats));
+        EXPECT_EQ(stats.count, 0U);
+        EXPECT_EQ(stats.sum, 0U);
+    }
+}
+} // namespace
+} // namespace diag
+
+#endif /** TESTSUITE */
@@ -0,0 +1,58 @@
+/**
+ * @brief Unit tests for the stack painting.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "diag/stack.h"
+
+#ifdef TESTSUITE
+
+namespace diag
+{
+namespace
+{
+/**
+ * @brief Stack high-water mark test.
+ * 
+ *        Verify that the unused bytes of a painted region are counted up to the deepest 
+ *        overwritten byte.
+ */
+TEST(Diag_Stack, HighWaterMark)
+{
+    constexpr std::uint16_t size{64U};
+    std::uint8_t region[size]{};
+    const std::uint8_t* end{region + size};
+
+    // Case 1 - Paint the region, expect all bytes to be unused.
+    {
+        EXPECT_EQ(stack::unusedBytes(region, end), 0U);
+        stack::paint(region, end);
+        EXPECT_EQ(stack::unusedBytes(region, end), size);
+    }
+
+    // Case 2 - Use the top 16 bytes like a stack, expect 48 unused bytes.
+    {
+        for (std::uint16_t i{size - 16U}; i < size; ++i) { region[i] = 0U; }
+        EXPECT_EQ(stack::unusedBytes(region, end), size - 16U);
+    }
+
+    // Case 3 - Restore the pattern on the used bytes (the stack may hold the pattern value),
+    //          then overwrite a deeper byte, expect the deeper byte to set the high-water mark.
+    {
+        stack::paint(region + size - 16U, end);
+        region[10U] = 0U;
+        EXPECT_EQ(stack::unusedBytes(region, end), 10U);
+    }
+
+    // Case 4 - Verify that invalid regions are rejected.
+    {
+        EXPECT_EQ(stack::unusedBytes(nullptr, end), 0U);
+        EXPECT_EQ(stack::unusedBytes(region, region), 0U);
+    }
+}
+} // namespace
+} // namespace diag
+
+#endif /** TESTSUITE */
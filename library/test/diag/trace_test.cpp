@@ -0,0 +1,105 @@
+/**
+ * @brief Unit tests for the trace buffer.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "diag/trace.h"
+
+#ifdef TESTSUITE
+
+namespace diag
+{
+namespace
+{
+/**
+ * @brief Trace buffer test.
+ * 
+ *        Verify that the events are recorded in order and that the oldest events are 
+ *        overwritten when the buffer is full.
+ */
+TEST(Diag_Trace, Record)
+{
+    trace::reset();
+    trace::setTrigger(trace::Id::Count, 0U);
+
+    // Case 1 - Record an event, expect it to be timestamped.
+    {
+        TCNT1 = 1234U;
+        trace::record(trace::Id::Temperature, 25U);
+
+        trace::Record record{};
+        EXPECT_EQ(trace::size(), 1U);
+        EXPECT_TRUE(trace::read(0U, record));
+        EXPECT_EQ(record.id, trace::Id::Temperature);
+        EXPECT_EQ(record.time, 1234U);
+        EXPECT_EQ(record.arg, 25U);
+        EXPECT_FALSE(trace::read(1U, record));
+    }
+
+    // Case 2 - Overfill the buffer, expect the newest events to be kept, oldest first.
+    {
+        for (std::uint16_t i{}; i < trace::Capacity + 10U; ++i) 
+        { 
+            trace::record(trace::Id::EepromWrite, i); 
+        }
+        EXPECT_EQ(trace::size(), trace::Capacity);
+
+        trace::Record record{};
+        EXPECT_TRUE(trace::read(0U, record));
+        EXPECT_EQ(record.arg, 10U);
+        EXPECT_TRUE(trace::read(trace::Capacity - 1U, record));
+        EXPECT_EQ(record.arg, trace::Capacity + 9U);
+    }
+}
+
+/**
+ * @brief Trace trigger test.
+ * 
+ *        Verify that the trace is frozen after the given number of events following the 
+ *        trigger event.
+ */
+TEST(Diag_Trace, Trigger)
+{
+    trace::reset();
+    trace::setTrigger(trace::Id::DeadlineMiss, 2U);
+
+    // Case 1 - Record the trigger event followed by three events, expect the last one dropped.
+    {
+        trace::record(trace::Id::TaskStart, 1U);
+        trace::record(trace::Id::DeadlineMiss, 1U);
+        EXPECT_FALSE(trace::isFrozen());
+        trace::record(trace::Id::TaskEnd, 1U);
+        trace::record(trace::Id::Sleep);
+        EXPECT_TRUE(trace::isFrozen());
+        trace::record(trace::Id::Wake);
+        EXPECT_EQ(trace::size(), 4U);
+    }
+
+    // Case 2 - Reset the trace, expect recording to continue with the trigger re-armed.
+    {
+        trace::reset();
+        EXPECT_FALSE(trace::isFrozen());
+        trace::record(trace::Id::DeadlineMiss, 2U);
+        trace::record(trace::Id::TaskStart, 1U);
+        EXPECT_FALSE(trace::isFrozen());
+        trace::record(trace::Id::TaskEnd, 1U);
+        EXPECT_TRUE(trace::isFrozen());
+    }
+
+    // Case 3 - Freeze the trace manually, expect no more events to be recorded.
+    {
+        trace::reset();
+        trace::setTrigger(trace::Id::Count, 0U);
+        trace::freeze();
+        trace::record(trace::Id::Sleep);
+        EXPECT_EQ(trace::size(), 0U);
+        trace::reset();
+    }
+}
+} // namespace
+} // namespace diag
+
+#endif /** TESTSUITE */
@@ -31,6 +31,21 @@ constexpr double computeInputVoltage(const std::uint16_t adcVal) noexcept
     return computeDutyCycle(adcVal) * supplyVoltage;
 }
 
+// -----------------------------------------------------------------------------
+constexpr std::uint16_t computeDutyCycleQ15(const std::uint16_t adcVal) noexcept
+{
+    // Convert the ADC value to a duty cycle in Q1.15 format (1.0 = 32768).
+    constexpr double scale{32768.0};
+    return utils::round<std::uint16_t>(computeDutyCycle(adcVal) * scale);
+}
+
+// -----------------------------------------------------------------------------
+constexpr std::uint16_t computeInputVoltage_mV(const std::uint16_t adcVal) noexcept
+{
+    // Convert the ADC value to a voltage in millivolts.
+    return utils::round<std::uint16_t>(computeInputVoltage(adcVal) * 1000.0);
+}
+
 // -----------------------------------------------------------------------------
 adc::Interface& setupAdc() noexcept
 {
@@ -108,6 +123,8 @@ TEST(Adc_Atmega328p, Read)
                 EXPECT_EQ(adc.read(pin), adcVal); 
                 EXPECT_EQ(adc.dutyCycle(pin), computeDutyCycle(adcVal));
                 EXPECT_EQ(adc.inputVoltage(pin), computeInputVoltage(adcVal));
+                EXPECT_EQ(adc.dutyCycle_q15(pin), computeDutyCycleQ15(adcVal));
+                EXPECT_EQ(adc.inputVoltage_mV(pin), computeInputVoltage_mV(adcVal));
             }
             else 
             { 
@@ -116,10 +133,98 @@ TEST(Adc_Atmega328p, Read)
                 EXPECT_EQ(adc.read(pin), defaultAdcVal); 
                 EXPECT_EQ(adc.dutyCycle(pin), defaultAdcVal);
                 EXPECT_EQ(adc.inputVoltage(pin), defaultAdcVal);
+                EXPECT_EQ(adc.dutyCycle_q15(pin), defaultAdcVal);
+                EXPECT_EQ(adc.inputVoltage_mV(pin), defaultAdcVal);
             }
         }
     }
 }
+
+/**
+ * @brief ADC fixed-point test.
+ * 
+ *        Verify that the integer conversions match the floating-point conversions for every
+ *        possible ADC value.
+ */
+TEST(Adc_Atmega328p, FixedPoint)
+{
+    // Set up the ADC.
+    adc::Interface& adc{setupAdc()};
+    constexpr std::uint8_t pin{adc::Atmega328p::Pin::A0};
+    constexpr std::uint16_t supplyVoltage_mV{5000U};
+
+    // Expect the supply voltage in millivolts to match the supply voltage in Volts.
+    EXPECT_EQ(adc.supplyVoltage_mV(), supplyVoltage_mV);
+    EXPECT_EQ(adc.supplyVoltage() * 1000.0, adc.supplyVoltage_mV());
+
+    // Expect the integer conversions to round the floating-point conversions for all values.
+    for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); ++adcVal)
+    {
+        ADC = adcVal;
+        EXPECT_EQ(adc.dutyCycle_q15(pin), computeDutyCycleQ15(adcVal));
+        EXPECT_EQ(adc.inputVoltage_mV(pin), computeInputVoltage_mV(adcVal));
+    }
+}
+
+/**
+ * @brief ADC noise reduction test.
+ * 
+ *        Verify that conversions are performed in ADC noise reduction sleep mode when enabled,
+ *        and that polling is used when interrupts are disabled.
+ */
+TEST(Adc_Atmega328p, NoiseReduction)
+{
+    // Set up the ADC.
+    adc::Interface& adc{setupAdc()};
+    constexpr std::uint8_t pin{adc::Atmega328p::Pin::A1};
+    constexpr std::uint16_t adcVal{512U};
+    constexpr std::uint8_t sleepModeMask{(1U << SM2) | (1U << SM1) | (1U << SM0)};
+
+    // Expect polling to be used by default, expect invalid read modes to be rejected.
+    EXPECT_EQ(adc.readMode(), adc::ReadMode::Polling);
+    EXPECT_FALSE(adc.setReadMode(adc::ReadMode::Count));
+    EXPECT_EQ(adc.readMode(), adc::ReadMode::Polling);
+
+    // Enable noise reduction.
+    EXPECT_TRUE(adc.setReadMode(adc::ReadMode::NoiseReduction));
+    EXPECT_EQ(adc.readMode(), adc::ReadMode::NoiseReduction);
+
+    // Case 1 - Read with interrupts enabled.
+    // Expect ADC noise reduction sleep mode to be selected and the conversion to be complete.
+    // Expect sleep and the ADC interrupt to be disabled after the conversion.
+    {
+        utils::globalInterruptEnable();
+        ADCSRA = 0U;
+        SMCR   = 0U;
+        ADC    = adcVal;
+
+        EXPECT_EQ(adc.read(pin), adcVal);
+        EXPECT_EQ(SMCR & sleepModeMask, (1U << SM0));
+        EXPECT_FALSE(utils::read(SMCR, SE));
+        EXPECT_FALSE(utils::read(ADCSRA, ADIE));
+        EXPECT_FALSE(utils::read(ADCSRA, ADSC));
+        EXPECT_TRUE(utils::read(ADCSRA, ADEN));
+    }
+
+    // Case 2 - Read with interrupts disabled.
+    // Expect polling to be used, since the CPU cannot be woken up by the ADC interrupt.
+    {
+        utils::globalInterruptDisable();
+        ADCSRA = 0U;
+        SMCR   = 0U;
+        ADC    = adcVal;
+        utils::set(ADCSRA, ADIF);
+
+        EXPECT_EQ(adc.read(pin), adcVal);
+        EXPECT_EQ(SMCR, 0U);
+        EXPECT_TRUE(utils::read(ADCSRA, ADSC));
+        EXPECT_FALSE(utils::read(ADCSRA, ADIE));
+    }
+
+    // Restore the default read mode.
+    EXPECT_TRUE(adc.setReadMode(adc::ReadMode::Polling));
+    utils::globalInterruptEnable();
+}
 } // namespace
 } // namespace driver
 
@@ -14,6 +14,12 @@
 
 namespace driver
 {
+namespace eeprom
+{
+/** EEPROM ready interrupt service routine, which drains the write queue. */
+void EE_READY_vect() noexcept;
+} // namespace eeprom
+
 namespace
 {
 /** EEPROM size in bytes. */
@@ -136,6 +142,20 @@ void readFromEeprom(eeprom::Interface& eeprom, const std::uint16_t addr) noexcep
     }
 }
 
+/** The number of invoked write callbacks. */
+std::uint8_t myCallbackCount{};
+
+// -----------------------------------------------------------------------------
+void writeCallback() noexcept { ++myCallbackCount; }
+
+// -----------------------------------------------------------------------------
+void simulateWriteComplete() noexcept
+{
+    // Clear the write enable flag, then invoke the EEPROM ready interrupt.
+    utils::clear(EECR, EEPE);
+    eeprom::EE_READY_vect();
+}
+
 /**
  * @brief EEPROM write test.
  * 
@@ -180,6 +200,255 @@ TEST(Eeprom_Atmega328p, Read)
         readFromEeprom(eeprom, addr);
     }
 }
+
+/**
+ * @brief EEPROM asynchronous write test.
+ * 
+ *        Verify that queued writes are performed by the EEPROM ready interrupt, that pending 
+ *        data is returned on read and that the callback is invoked once all bytes are written.
+ */
+TEST(Eeprom_Atmega328p, WriteAsync)
+{
+    eeprom::Interface& eeprom{eeprom::Atmega328p::getInstance()};
+    constexpr std::uint16_t addr{10U};
+    constexpr std::uint16_t data{0xABCDU};
+    constexpr std::uint8_t dataSize{sizeof(data)};
+    constexpr std::uint16_t queueSize{16U};
+    myCallbackCount = 0U;
+
+    // Case 1 - Try to queue data when the EEPROM is disabled, expect the operation to fail.
+    {
+        eeprom.setEnabled(false);
+        EECR = 0U;
+        EXPECT_FALSE(eeprom.writeAsync(addr, data, writeCallback));
+        EXPECT_EQ(eeprom.pendingWrites(), 0U);
+        EXPECT_EQ(EECR, 0U);
+    }
+
+    // Case 2 - Queue data when enabled.
+    // Expect the bytes to be queued and the EEPROM ready interrupt to be enabled.
+    {
+        eeprom.setEnabled(true);
+        EEAR = 0U;
+        EEDR = 0U;
+        EXPECT_TRUE(eeprom.writeAsync(addr, data, writeCallback));
+        EXPECT_EQ(eeprom.pendingWrites(), dataSize);
+        EXPECT_TRUE(utils::read(EECR, EERIE));
+        EXPECT_EQ(EEAR, 0U);
+    }
+
+    // Case 3 - Simulate the EEPROM ready interrupt, expect the first byte to be written.
+    // Expect the pending second byte to be returned on read without accessing the registers.
+    {
+        simulateWriteComplete();
+        EXPECT_EQ(eeprom.pendingWrites(), dataSize - 1U);
+        EXPECT_EQ(EEAR, addr);
+        EXPECT_EQ(EEDR, static_cast<std::uint8_t>(data));
+        EXPECT_TRUE(utils::read(EECR, EEPE));
+
+        std::uint8_t pendingData{};
+        EXPECT_TRUE(eeprom.read(addr + 1U, pendingData));
+        EXPECT_EQ(pendingData, static_cast<std::uint8_t>(data >> 8U));
+        EXPECT_EQ(EEAR, addr);
+    }
+
+    // Case 4 - Simulate the EEPROM ready interrupt, expect the second byte to be written.
+    // Expect the callback to not be invoked until the write is complete.
+    {
+        simulateWriteComplete();
+        EXPECT_EQ(eeprom.pendingWrites(), 0U);
+        EXPECT_EQ(EEAR, addr + 1U);
+        EXPECT_EQ(EEDR, static_cast<std::uint8_t>(data >> 8U));
+        EXPECT_EQ(myCallbackCount, 0U);
+    }
+
+    // Case 5 - Simulate the EEPROM ready interrupt once more.
+    // Expect the callback to be invoked and the EEPROM ready interrupt to be disabled.
+    {
+        simulateWriteComplete();
+        EXPECT_EQ(myCallbackCount, 1U);
+        EXPECT_FALSE(utils::read(EECR, EERIE));
+    }
+
+    // Case 6 - Fill the write queue, expect writes that don't fit to be rejected.
+    // Expect the queue to be drained by the EEPROM ready interrupt.
+    {
+        constexpr std::uint64_t largeData{0x0123456789ABCDEFULL};
+        EXPECT_TRUE(eeprom.writeAsync(addr, largeData));
+        EXPECT_TRUE(eeprom.writeAsync(addr + sizeof(largeData), largeData, writeCallback));
+        EXPECT_EQ(eeprom.pendingWrites(), queueSize);
+        EXPECT_FALSE(eeprom.writeAsync<std::uint8_t>(addr, 0U));
+
+        for (std::uint16_t i{}; i <= queueSize; ++i) { simulateWriteComplete(); }
+        EXPECT_EQ(eeprom.pendingWrites(), 0U);
+        EXPECT_EQ(myCallbackCount, 2U);
+        EXPECT_FALSE(utils::read(EECR, EERIE));
+    }
+
+    // Case 7 - Queue a single byte, then flush the queue.
+    // Expect the byte to be written before returning.
+    {
+        constexpr std::uint8_t byte{0x5AU};
+        EECR = 0U;
+        EXPECT_TRUE(eeprom.writeAsync(addr, byte));
+        eeprom.flush();
+        EXPECT_EQ(eeprom.pendingWrites(), 0U);
+        EXPECT_EQ(EEAR, addr);
+        EXPECT_EQ(EEDR, byte);
+    }
+
+    // Case 8 - Queue, read and flush a byte with interrupts disabled.
+    // Expect the interrupt state to be restored rather than interrupts to be enabled.
+    {
+        constexpr std::uint8_t byte{0xA5U};
+        std::uint8_t queued{};
+        utils::globalInterruptDisable();
+        EECR = 0U;
+        EXPECT_TRUE(eeprom.writeAsync(addr, byte));
+        EXPECT_TRUE(eeprom.read(addr, queued));
+        EXPECT_EQ(queued, byte);
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+
+        eeprom.flush();
+        EXPECT_EQ(eeprom.pendingWrites(), 0U);
+        EXPECT_EQ(EEDR, byte);
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+        utils::globalInterruptEnable();
+    }
+}
+
+/**
+ * @brief EEPROM block update test.
+ * 
+ *        Verify that unchanged bytes are skipped and that bytes where only bits are cleared 
+ *        are written without prior erase.
+ */
+TEST(Eeprom_Atmega328p, UpdateBlock)
+{
+    eeprom::Interface& eeprom{eeprom::Atmega328p::getInstance()};
+    constexpr std::uint16_t addr{20U};
+    constexpr std::uint8_t writeOnlyMode{1U << EEPM1};
+    constexpr std::uint8_t eraseAndWrite{(1U << EEMPE) | (1U << EEPE)};
+
+    // Case 1 - Try to update a block with invalid parameters or when disabled.
+    // Expect the operation to fail, also if the end address wraps around.
+    {
+        constexpr std::uint8_t data{0x0FU};
+        std::uint8_t block[2U]{};
+        eeprom.setEnabled(false);
+        EECR = 0U;
+        EXPECT_FALSE(eeprom.updateBlock(addr, &data, sizeof(data)));
+        eeprom.setEnabled(true);
+        EXPECT_FALSE(eeprom.updateBlock(addr, nullptr, sizeof(data)));
+        EXPECT_FALSE(eeprom.updateBlock(EepromSize, &data, sizeof(data)));
+        EXPECT_FALSE(eeprom.updateBlock(EepromSize - 1U, block, sizeof(block)));
+        EXPECT_FALSE(eeprom.updateBlock(UINT16_MAX, block, sizeof(block)));
+        EXPECT_FALSE(eeprom.readBlock(UINT16_MAX, block, sizeof(block)));
+        EXPECT_EQ(EECR, 0U);
+    }
+
+    // Case 2 - Update a byte where only bits are cleared.
+    // Expect the byte to be programmed in write-only mode.
+    {
+        constexpr std::uint8_t data{0x0FU};
+        EEDR = 0xFFU;
+        EXPECT_TRUE(eeprom.updateBlock(addr, &data, sizeof(data)));
+        EXPECT_EQ(EEAR, addr);
+        EXPECT_EQ(EEDR, data);
+        EXPECT_EQ(EECR, eraseAndWrite | writeOnlyMode | (1U << EERE));
+    }
+
+    // Case 3 - Update the byte with the stored value, expect the write to be skipped.
+    {
+        constexpr std::uint8_t data{0x0FU};
+        EECR = 0U;
+        EEAR = 0U;
+        EXPECT_TRUE(eeprom.updateBlock(addr, &data, sizeof(data)));
+        EXPECT_FALSE(utils::read(EECR, EEPE));
+        EXPECT_EQ(EEDR, data);
+    }
+
+    // Case 4 - Update the byte where bits are set, expect the byte to be erased and written.
+    {
+        constexpr std::uint8_t data{0xF0U};
+        EECR = 0U;
+        EXPECT_TRUE(eeprom.updateBlock(addr, &data, sizeof(data)));
+        EXPECT_EQ(EEAR, addr);
+        EXPECT_EQ(EEDR, data);
+        EXPECT_EQ(EECR, eraseAndWrite | (1U << EERE));
+    }
+
+    // Case 5 - Read a trivially copyable object, expect each byte to be read.
+    {
+        struct Config
+        {
+            std::uint8_t mode;
+            std::uint16_t threshold;
+        };
+        constexpr std::uint8_t stored{0x5AU};
+        Config config{};
+        EECR = 0U;
+        EEDR = stored;
+        EXPECT_TRUE(eeprom.readObject(addr, config));
+        EXPECT_EQ(config.mode, stored);
+        EXPECT_EQ(EEAR, addr + sizeof(Config) - 1U);
+    }
+}
+
+/**
+ * @brief EEPROM block update from interrupt context test.
+ * 
+ *        Verify that bytes are written directly, leaving the write queue and the global 
+ *        interrupt state untouched.
+ */
+TEST(Eeprom_Atmega328p, UpdateBlockFromIsr)
+{
+    eeprom::Interface& eeprom{eeprom::Atmega328p::getInstance()};
+    constexpr std::uint16_t queuedAddr{30U};
+    constexpr std::uint16_t addr{40U};
+    constexpr std::uint8_t data{0xF0U};
+    constexpr std::uint8_t eraseAndWrite{(1U << EEMPE) | (1U << EEPE)};
+    myCallbackCount = 0U;
+
+    // Case 1 - Queue a byte, then update a byte with interrupts disabled, as in an interrupt.
+    // Expect the byte to be written while the queued byte and its callback remain pending.
+    // Expect interrupts to remain disabled.
+    {
+        eeprom.setEnabled(true);
+        EECR = 0U;
+        EXPECT_TRUE(eeprom.writeAsync<std::uint8_t>(queuedAddr, 0x5AU, writeCallback));
+        utils::globalInterruptDisable();
+        EEDR = 0U;
+        EXPECT_TRUE(eeprom.updateObjectFromIsr(addr, data));
+        EXPECT_EQ(EEAR, addr);
+        EXPECT_EQ(EEDR, data);
+        EXPECT_EQ(EECR & eraseAndWrite, eraseAndWrite);
+        EXPECT_EQ(eeprom.pendingWrites(), 1U);
+        EXPECT_EQ(myCallbackCount, 0U);
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+    }
+
+    // Case 2 - Update the byte with the stored value, expect the write to be skipped.
+    {
+        EECR = (1U << EERIE);
+        EXPECT_TRUE(eeprom.updateObjectFromIsr(addr, data));
+        EXPECT_FALSE(utils::read(EECR, EEPE));
+        EXPECT_EQ(eeprom.pendingWrites(), 1U);
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+    }
+
+    // Case 3 - Simulate the EEPROM ready interrupt, expect the queued byte to be written.
+    // Expect the callback to be invoked once the write is complete.
+    {
+        utils::globalInterruptEnable();
+        simulateWriteComplete();
+        EXPECT_EQ(eeprom.pendingWrites(), 0U);
+        EXPECT_EQ(EEAR, queuedAddr);
+        simulateWriteComplete();
+        EXPECT_EQ(myCallbackCount, 1U);
+        EXPECT_FALSE(utils::read(EECR, EERIE));
+    }
+}
 } // namespace
 } // namespace driver
 
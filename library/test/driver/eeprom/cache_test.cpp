@@ -0,0 +1,131 @@
+/**
+ * @brief Unit tests for the EEPROM cache.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/cache.h"
+#include "driver/eeprom/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** EEPROM size in bytes. */
+constexpr std::uint16_t EepromSize{64U};
+
+/** Start address of the cached window. */
+constexpr std::uint16_t WindowStart{16U};
+
+/** Size of the cached window in bytes. */
+constexpr std::uint16_t WindowSize{8U};
+
+/** The number of times the write callback has been invoked. */
+std::uint8_t myCallbackCount{};
+
+// -----------------------------------------------------------------------------
+void writeCallback() noexcept { myCallbackCount++; }
+
+/**
+ * @brief EEPROM cache test.
+ */
+TEST(Eeprom_Cache, ReadWrite)
+{
+    eeprom::Stub<EepromSize> eeprom{};
+    constexpr std::uint8_t stored{0x3CU};
+
+    for (std::uint16_t i{}; i < EepromSize - 1U; ++i) { eeprom.write(i, stored); }
+
+    // Case 1 - Verify that the window is only loaded if it fits within the EEPROM.
+    {
+        eeprom::Cache<WindowSize> invalid{eeprom, EepromSize - WindowSize / 2U};
+        EXPECT_FALSE(invalid.isInitialized());
+        EXPECT_FALSE(invalid.isLoaded());
+    }
+
+    // Case 2 - Verify that the window is loaded once the EEPROM stream is enabled.
+    {
+        eeprom.setEnabled(false);
+        eeprom::Cache<WindowSize> cache{eeprom, WindowStart};
+        EXPECT_TRUE(cache.isInitialized());
+        EXPECT_FALSE(cache.isLoaded());
+
+        cache.setEnabled(true);
+        EXPECT_TRUE(eeprom.isEnabled());
+        EXPECT_TRUE(cache.isLoaded());
+        EXPECT_EQ(cache.size(), EepromSize);
+    }
+
+    eeprom::Cache<WindowSize> cache{eeprom, WindowStart};
+    EXPECT_TRUE(cache.isLoaded());
+
+    // Case 3 - Verify that reads within the window are served from RAM.
+    {
+        // Write to the underlying EEPROM directly, expect the cached data to be returned.
+        constexpr std::uint8_t bypassed{0xFFU};
+        eeprom.write(WindowStart, bypassed);
+
+        std::uint8_t data{};
+        EXPECT_TRUE(cache.read(WindowStart, data));
+        EXPECT_EQ(data, stored);
+
+        // Expect reads outside the window to be forwarded.
+        constexpr std::uint16_t outside{WindowStart + WindowSize};
+        eeprom.write(outside, bypassed);
+        EXPECT_TRUE(cache.read(outside, data));
+        EXPECT_EQ(data, bypassed);
+
+        // Restore the byte bypassing the cache.
+        eeprom.write(WindowStart, stored);
+    }
+
+    // Case 4 - Verify that writes update both the EEPROM and the cached window.
+    {
+        constexpr std::uint16_t expected{0xBEEFU};
+        std::uint16_t data{};
+        EXPECT_TRUE(cache.write(WindowStart + 1U, expected));
+        EXPECT_TRUE(cache.read(WindowStart + 1U, data));
+        EXPECT_EQ(data, expected);
+        EXPECT_TRUE(eeprom.read(WindowStart + 1U, data));
+        EXPECT_EQ(data, expected);
+
+        // Expect a write across the window border to be split correctly.
+        EXPECT_TRUE(cache.write(WindowStart + WindowSize - 1U, expected));
+        EXPECT_TRUE(cache.read(WindowStart + WindowSize - 1U, data));
+        EXPECT_EQ(data, expected);
+    }
+
+    // Case 5 - Verify that block updates skip unchanged bytes and keep the cache coherent.
+    {
+        const std::uint16_t writeCount{eeprom.writeCount()};
+        const std::uint8_t block[]{stored, static_cast<std::uint8_t>(stored & 0x0FU)};
+        EXPECT_TRUE(cache.updateBlock(WindowStart + 3U, block, sizeof(block)));
+        EXPECT_EQ(eeprom.writeCount(), writeCount + 1U);
+
+        std::uint8_t data[sizeof(block)]{};
+        EXPECT_TRUE(cache.readBlock(WindowStart + 3U, data, sizeof(data)));
+        EXPECT_EQ(data[0U], block[0U]);
+        EXPECT_EQ(data[1U], block[1U]);
+        EXPECT_TRUE(eeprom.readBlock(WindowStart + 3U, data, sizeof(data)));
+        EXPECT_EQ(data[1U], block[1U]);
+    }
+
+    // Case 6 - Verify that queued writes update the cached window and invoke the callback.
+    {
+        constexpr std::uint8_t expected{0x42U};
+        std::uint8_t data{};
+        myCallbackCount = 0U;
+        EXPECT_TRUE(cache.writeAsync(WindowStart + 6U, expected, writeCallback));
+        EXPECT_EQ(myCallbackCount, 1U);
+        EXPECT_EQ(cache.pendingWrites(), 0U);
+        EXPECT_TRUE(cache.read(WindowStart + 6U, data));
+        EXPECT_EQ(data, expected);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,153 @@
+/**
+ * @brief Unit tests for the file-backed EEPROM stream.
+ */
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/file.h"
+#include "driver/eeprom/slot.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::string imagePath(const char* name) noexcept
+{
+    // Start from a new image file each run.
+    const std::string path{testing::TempDir() + name};
+    std::remove(path.c_str());
+    return path;
+}
+
+/**
+ * @brief File-backed EEPROM tests.
+ */
+TEST(Eeprom_File, Persistence)
+{
+    const std::string path{imagePath("eeprom_file_persistence.bin")};
+    constexpr std::uint16_t addr{100U};
+    constexpr std::uint16_t data{0xABCDU};
+
+    // Case 1 - Verify that a new image file is created in erased state.
+    {
+        eeprom::File eeprom{path.c_str()};
+        EXPECT_TRUE(eeprom.isInitialized());
+        EXPECT_EQ(eeprom.size(), eeprom::File::Size);
+
+        std::uint8_t byte{};
+        EXPECT_TRUE(eeprom.read(0U, byte));
+        EXPECT_EQ(byte, 0xFFU);
+        EXPECT_EQ(eeprom.time_us(), 0U);
+
+        eeprom::File invalid{nullptr};
+        EXPECT_FALSE(invalid.isInitialized());
+    }
+
+    // Case 2 - Write data, expect it to persist after a power cycle.
+    {
+        eeprom::File eeprom{path.c_str()};
+        EXPECT_TRUE(eeprom.write(addr, data));
+    }
+    {
+        eeprom::File eeprom{path.c_str()};
+        std::uint16_t readData{};
+        EXPECT_TRUE(eeprom.read(addr, readData));
+        EXPECT_EQ(readData, data);
+        EXPECT_EQ(eeprom.totalWriteCount(), 0U);
+    }
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief File-backed EEPROM timing test.
+ * 
+ *        Verify that writes keep the EEPROM busy in virtual time.
+ */
+TEST(Eeprom_File, Timing)
+{
+    const std::string path{imagePath("eeprom_file_timing.bin")};
+    eeprom::File eeprom{path.c_str()};
+    constexpr std::uint16_t addr{10U};
+
+    // Case 1 - Write a byte, expect the EEPROM to be busy for the erase and write time.
+    {
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint8_t>(0xF0U)));
+        EXPECT_TRUE(eeprom.isBusy());
+        EXPECT_EQ(eeprom.time_us(), 0U);
+
+        eeprom.advanceTime(eeprom::File::EraseWriteTime_us);
+        EXPECT_FALSE(eeprom.isBusy());
+    }
+
+    // Case 2 - Write two bytes, expect the second byte to wait for the first one.
+    {
+        const std::uint64_t start{eeprom.time_us()};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint16_t>(0x1234U)));
+        eeprom.flush();
+        EXPECT_EQ(eeprom.time_us() - start, 2U * eeprom::File::EraseWriteTime_us);
+    }
+
+    // Case 3 - Update a byte where only bits are cleared, expect the write only time.
+    // Expect unchanged bytes to not be written at all.
+    {
+        const std::uint64_t start{eeprom.time_us()};
+        const std::uint8_t data[]{0x30U, 0x12U};
+        EXPECT_TRUE(eeprom.updateBlock(addr, data, sizeof(data)));
+        eeprom.flush();
+        EXPECT_EQ(eeprom.time_us() - start, eeprom::File::WriteOnlyTime_us);
+        EXPECT_EQ(eeprom.writeCount(addr), 3U);
+        EXPECT_EQ(eeprom.writeCount(addr + 1U), 1U);
+        EXPECT_EQ(eeprom.writeCount(eeprom::File::Size), 0U);
+    }
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief File-backed EEPROM soak test.
+ * 
+ *        Verify that a wear-leveled slot is restored across power cycles and that the writes 
+ *        are spread evenly across its records.
+ */
+TEST(Eeprom_File, WearLeveling)
+{
+    const std::string path{imagePath("eeprom_file_wear_leveling.bin")};
+    constexpr std::uint16_t startAddr{0U};
+    constexpr std::uint16_t regionSize{64U};
+    constexpr std::uint16_t powerCycles{20U};
+    constexpr std::uint16_t writesPerCycle{21U};
+    std::uint32_t maxWriteCount{};
+
+    for (std::uint16_t cycle{}; cycle < powerCycles; ++cycle)
+    {
+        eeprom::File eeprom{path.c_str()};
+        eeprom::Slot<std::uint8_t> slot{eeprom, startAddr, regionSize};
+        std::uint8_t state{};
+
+        // Expect the state written before the power cycle to be restored.
+        EXPECT_TRUE(slot.restore());
+        EXPECT_EQ(slot.read(state), 0U < cycle);
+        if (0U < cycle) { EXPECT_EQ(state, (cycle - 1U) % 2U); }
+
+        // Toggle the state, then record the highest number of writes of a single cell.
+        for (std::uint16_t i{}; i < writesPerCycle; ++i) 
+        { 
+            EXPECT_TRUE(slot.write(static_cast<std::uint8_t>((cycle + i) % 2U)));
+            eeprom.advanceTime(eeprom::File::EraseWriteTime_us);
+        }
+        if (maxWriteCount < eeprom.maxWriteCount()) { maxWriteCount = eeprom.maxWriteCount(); }
+    }
+
+    // Expect each cell to be written about once per record rotation.
+    EXPECT_LE(maxWriteCount, 2U);
+    std::remove(path.c_str());
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,206 @@
+/**
+ * @brief Unit tests for the wear-leveled EEPROM slot.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/slot.h"
+#include "driver/eeprom/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** EEPROM size in bytes. */
+constexpr std::uint16_t EepromSize{64U};
+
+/** Start address of the slot region. */
+constexpr std::uint16_t StartAddress{8U};
+
+/** Size of the slot region in bytes (fits four 16-bit records). */
+constexpr std::uint16_t RegionSize{16U};
+
+/** Record size in bytes (16-bit value followed by a 16-bit sequence number). */
+constexpr std::uint16_t RecordSize{4U};
+
+// -----------------------------------------------------------------------------
+void eraseRegion(eeprom::Interface& eeprom) noexcept
+{
+    for (std::uint16_t i{}; i < RegionSize; ++i) 
+    { 
+        eeprom.write(StartAddress + i, static_cast<std::uint8_t>(0xFFU)); 
+    }
+}
+
+// -----------------------------------------------------------------------------
+std::uint16_t readRecordSequence(eeprom::Interface& eeprom, const std::uint16_t index) noexcept
+{
+    std::uint16_t sequence{};
+    eeprom.read(StartAddress + index * RecordSize + sizeof(std::uint16_t), sequence);
+    return sequence;
+}
+
+/**
+ * @brief Wear-leveled slot tests.
+ */
+TEST(Eeprom_Slot, ReadWrite)
+{
+    eeprom::Stub<EepromSize> eeprom{};
+    eraseRegion(eeprom);
+
+    // Case 1 - Verify that the slot is initialized only if the region fits at least two records.
+    {
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(slot.isInitialized());
+        EXPECT_EQ(slot.recordCount(), RegionSize / RecordSize);
+
+        eeprom::Slot<std::uint16_t> tooSmall{eeprom, StartAddress, RecordSize};
+        EXPECT_FALSE(tooSmall.isInitialized());
+        EXPECT_FALSE(tooSmall.restore());
+
+        eeprom::Slot<std::uint16_t> outOfRange{eeprom, EepromSize - RecordSize, RegionSize};
+        EXPECT_FALSE(outOfRange.isInitialized());
+        EXPECT_FALSE(outOfRange.restore());
+    }
+
+    // Case 2 - Verify that an erased region is restored as empty.
+    {
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+        std::uint16_t value{};
+
+        // Expect reads to fail before the slot has been restored.
+        EXPECT_FALSE(slot.isRestored());
+        EXPECT_FALSE(slot.read(value));
+
+        EXPECT_TRUE(slot.restore());
+        EXPECT_TRUE(slot.isRestored());
+        EXPECT_TRUE(slot.isEmpty());
+        EXPECT_FALSE(slot.read(value));
+    }
+
+    // Case 3 - Verify that restoring fails when the EEPROM stream is disabled.
+    {
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+        eeprom.setEnabled(false);
+        EXPECT_FALSE(slot.restore());
+        EXPECT_FALSE(slot.isRestored());
+        eeprom.setEnabled(true);
+    }
+
+    // Case 4 - Verify that writes are rotated across the records of the region.
+    {
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+
+        // Write more values than there are records, expect the records to be reused.
+        for (std::uint16_t i{}; i < 2U * slot.recordCount() + 1U; ++i)
+        {
+            const std::uint16_t expected{static_cast<std::uint16_t>(1000U + i)};
+            std::uint16_t value{};
+            EXPECT_TRUE(slot.write(expected));
+            EXPECT_TRUE(slot.read(value));
+            EXPECT_EQ(value, expected);
+            EXPECT_EQ(slot.sequence(), i);
+
+            // Expect the record to hold the value followed by the sequence number.
+            const std::uint16_t index{static_cast<std::uint16_t>(i % slot.recordCount())};
+            std::uint16_t stored{};
+            EXPECT_TRUE(eeprom.read(StartAddress + index * RecordSize, stored));
+            EXPECT_EQ(stored, expected);
+            EXPECT_EQ(readRecordSequence(eeprom, index), i);
+        }
+    }
+
+    // Case 5 - Verify that the latest record is located after a restart.
+    {
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+        std::uint16_t value{};
+        EXPECT_TRUE(slot.restore());
+        EXPECT_FALSE(slot.isEmpty());
+        EXPECT_TRUE(slot.read(value));
+        EXPECT_EQ(value, 1008U);
+        EXPECT_EQ(slot.sequence(), 8U);
+
+        // Expect the next write to continue the sequence.
+        EXPECT_TRUE(slot.write(2000U));
+        EXPECT_EQ(slot.sequence(), 9U);
+        EXPECT_EQ(readRecordSequence(eeprom, 1U), 9U);
+    }
+
+    // Case 6 - Verify that writing the stored value is skipped.
+    {
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(slot.write(2000U));
+        EXPECT_EQ(slot.sequence(), 9U);
+        EXPECT_EQ(readRecordSequence(eeprom, 2U), 6U);
+    }
+
+    // Case 7 - Verify that an interrupted write leaves the previous record intact.
+    {
+        // Write the value of the next record without its sequence number.
+        eeprom.write(StartAddress + 2U * RecordSize, static_cast<std::uint16_t>(3000U));
+
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+        std::uint16_t value{};
+        EXPECT_TRUE(slot.restore());
+        EXPECT_TRUE(slot.read(value));
+        EXPECT_EQ(value, 2000U);
+        EXPECT_EQ(slot.sequence(), 9U);
+    }
+
+    // Case 8 - Verify that the sequence number wraps around without using the erased value.
+    {
+        eraseRegion(eeprom);
+        eeprom::Slot<std::uint16_t> slot{eeprom, StartAddress, RegionSize};
+        
+        // Store a record with the largest sequence number manually.
+        eeprom.write(StartAddress, static_cast<std::uint16_t>(10U));
+        eeprom.write(StartAddress + sizeof(std::uint16_t), static_cast<std::uint16_t>(0xFFFEU));
+        EXPECT_TRUE(slot.restore());
+        EXPECT_EQ(slot.sequence(), 0xFFFEU);
+
+        EXPECT_TRUE(slot.write(11U));
+        EXPECT_EQ(slot.sequence(), 0U);
+
+        // Expect the record with wrapped sequence number to be located after a restart.
+        eeprom::Slot<std::uint16_t> restarted{eeprom, StartAddress, RegionSize};
+        std::uint16_t value{};
+        EXPECT_TRUE(restarted.restore());
+        EXPECT_TRUE(restarted.read(value));
+        EXPECT_EQ(value, 11U);
+        EXPECT_EQ(restarted.sequence(), 0U);
+    }
+
+    // Case 9 - Verify that a slot at the end of a fully erased EEPROM, as delivered from the 
+    // factory, is restored as empty and that written values are located after a restart.
+    {
+        eeprom::Stub<EepromSize> erased{};
+        for (std::uint16_t i{}; i < EepromSize; ++i) 
+        { 
+            erased.write(i, static_cast<std::uint8_t>(0xFFU)); 
+        }
+
+        eeprom::Slot<std::uint16_t> slot{erased, EepromSize - RegionSize, RegionSize};
+        std::uint16_t value{};
+        EXPECT_TRUE(slot.isInitialized());
+        EXPECT_TRUE(slot.restore());
+        EXPECT_TRUE(slot.isEmpty());
+        EXPECT_FALSE(slot.read(value));
+
+        EXPECT_TRUE(slot.write(42U));
+        EXPECT_EQ(slot.sequence(), 0U);
+
+        eeprom::Slot<std::uint16_t> restarted{erased, EepromSize - RegionSize, RegionSize};
+        EXPECT_TRUE(restarted.restore());
+        EXPECT_FALSE(restarted.isEmpty());
+        EXPECT_TRUE(restarted.read(value));
+        EXPECT_EQ(value, 42U);
+        EXPECT_EQ(restarted.sequence(), 0U);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,322 @@
+/**
+ * @brief Unit tests for the EEPROM key-value store.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/store.h"
+#include "driver/eeprom/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** EEPROM size in bytes. */
+constexpr std::uint16_t EepromSize{128U};
+
+/** Start address of the store region. */
+constexpr std::uint16_t StartAddress{8U};
+
+/** Size of the store region in bytes (two banks of 32 bytes). */
+constexpr std::uint16_t RegionSize{64U};
+
+/** The number of keys supported by the store. */
+constexpr std::uint8_t KeyCount{4U};
+
+/** Store type used in the tests. */
+using Store = eeprom::Store<KeyCount>;
+
+/**
+ * @brief Structure of configuration parameters stored under a single key.
+ */
+struct Config
+{
+    std::uint8_t mode;
+    std::uint16_t threshold;
+};
+
+// -----------------------------------------------------------------------------
+void eraseRegion(eeprom::Interface& eeprom) noexcept
+{
+    for (std::uint16_t i{}; i < RegionSize; ++i) 
+    { 
+        eeprom.write(StartAddress + i, static_cast<std::uint8_t>(0xFFU)); 
+    }
+}
+
+// -----------------------------------------------------------------------------
+void compact(Store& store) noexcept
+{
+    for (std::uint8_t i{}; (i < 2U * KeyCount + 2U) && store.compactStep(); ++i);
+    EXPECT_FALSE(store.isCompacting());
+}
+
+/**
+ * @brief Key-value store read/write tests.
+ */
+TEST(Eeprom_Store, ReadWrite)
+{
+    eeprom::Stub<EepromSize> eeprom{};
+    eraseRegion(eeprom);
+
+    // Case 1 - Verify that the store is only initialized if the region fits within the EEPROM.
+    {
+        Store store{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(store.isInitialized());
+
+        Store outOfRange{eeprom, EepromSize - RegionSize / 2U, RegionSize};
+        EXPECT_FALSE(outOfRange.isInitialized());
+        EXPECT_FALSE(outOfRange.restore());
+    }
+
+    // Case 2 - Verify that an erased region is formatted as an empty store.
+    {
+        Store store{eeprom, StartAddress, RegionSize};
+        EXPECT_FALSE(store.isRestored());
+        EXPECT_FALSE(store.contains(0U));
+
+        EXPECT_TRUE(store.restore());
+        EXPECT_TRUE(store.isRestored());
+        EXPECT_EQ(store.freeSpace(), RegionSize / 2U - sizeof(std::uint16_t));
+        EXPECT_EQ(store.deadSpace(), 0U);
+
+        for (std::uint8_t key{}; key < KeyCount; ++key) 
+        { 
+            EXPECT_FALSE(store.contains(key)); 
+            EXPECT_EQ(store.length(key), 0U);
+        }
+    }
+
+    // Case 3 - Write values of different types, expect them to be read back.
+    {
+        Store store{eeprom, StartAddress, RegionSize};
+        constexpr Config config{2U, 1000U};
+        Config readConfig{};
+        std::uint8_t toggleState{};
+
+        EXPECT_TRUE(store.write(0U, static_cast<std::uint8_t>(1U)));
+        EXPECT_TRUE(store.write(1U, config));
+        EXPECT_FALSE(store.write(KeyCount, config));
+
+        EXPECT_TRUE(store.read(0U, toggleState));
+        EXPECT_EQ(toggleState, 1U);
+        EXPECT_TRUE(store.read(1U, readConfig));
+        EXPECT_EQ(readConfig.mode, config.mode);
+        EXPECT_EQ(readConfig.threshold, config.threshold);
+        EXPECT_EQ(store.length(1U), sizeof(Config));
+
+        // Expect reads with mismatching size to fail.
+        std::uint16_t wrongSize{};
+        EXPECT_FALSE(store.read(0U, wrongSize));
+    }
+
+    // Case 4 - Verify that the index is restored after a restart.
+    // Expect values of unchanged length to be updated in place, skipping unchanged bytes.
+    {
+        Store store{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(store.restore());
+        const std::uint16_t freeSpace{store.freeSpace()};
+
+        Config config{};
+        EXPECT_TRUE(store.read(1U, config));
+        EXPECT_EQ(config.threshold, 1000U);
+
+        const std::uint16_t writeCount{eeprom.writeCount()};
+        config.mode = 3U;
+        EXPECT_TRUE(store.write(1U, config));
+        EXPECT_EQ(eeprom.writeCount(), writeCount + 1U);
+        EXPECT_EQ(store.freeSpace(), freeSpace);
+        EXPECT_EQ(store.deadSpace(), 0U);
+    }
+
+    // Case 5 - Change the length of a value, expect a new record to be appended.
+    // Expect the previous record to be marked dead.
+    {
+        Store store{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(store.restore());
+        const std::uint16_t freeSpace{store.freeSpace()};
+
+        std::uint16_t toggleState{};
+        EXPECT_TRUE(store.write(0U, static_cast<std::uint16_t>(0x0101U)));
+        EXPECT_TRUE(store.read(0U, toggleState));
+        EXPECT_EQ(toggleState, 0x0101U);
+        EXPECT_EQ(store.freeSpace(), freeSpace - 4U);
+        EXPECT_EQ(store.deadSpace(), 3U);
+
+        // Expect the removed value to be gone after a restart.
+        EXPECT_TRUE(store.remove(0U));
+        EXPECT_FALSE(store.remove(0U));
+        EXPECT_FALSE(store.contains(0U));
+        EXPECT_EQ(store.deadSpace(), 7U);
+
+        Store restarted{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(restarted.restore());
+        EXPECT_FALSE(restarted.contains(0U));
+        EXPECT_TRUE(restarted.contains(1U));
+        EXPECT_EQ(restarted.deadSpace(), 7U);
+    }
+
+    // Case 6 - Verify that an interrupted append is ignored after a restart.
+    {
+        Store store{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(store.restore());
+
+        // Write the length and data of a record for key 2 without committing its key.
+        const std::uint16_t end{static_cast<std::uint16_t>(StartAddress + RegionSize / 2U 
+            - store.freeSpace())};
+        eeprom.write(end + 1U, static_cast<std::uint8_t>(1U));
+        eeprom.write(end + 2U, static_cast<std::uint8_t>(0x55U));
+
+        Store restarted{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(restarted.restore());
+        EXPECT_FALSE(restarted.contains(2U));
+        EXPECT_EQ(restarted.freeSpace(), store.freeSpace());
+    }
+}
+
+/**
+ * @brief Key-value store compaction tests.
+ */
+TEST(Eeprom_Store, Compaction)
+{
+    eeprom::Stub<EepromSize> eeprom{};
+    eraseRegion(eeprom);
+    Store store{eeprom, StartAddress, RegionSize};
+    EXPECT_TRUE(store.restore());
+
+    // Case 1 - Expect no compaction to be started when there are no dead records.
+    {
+        EXPECT_FALSE(store.compactStep());
+        EXPECT_FALSE(store.isCompacting());
+    }
+
+    // Case 2 - Fill the bank by appending records, expect writes to fail once full.
+    {
+        EXPECT_TRUE(store.write(0U, static_cast<std::uint32_t>(0U)));
+        constexpr std::uint16_t value{};
+        while (store.write(1U, value)) { EXPECT_TRUE(store.remove(1U)); }
+        EXPECT_LT(store.freeSpace(), 4U);
+        EXPECT_GT(store.deadSpace(), 0U);
+    }
+
+    // Case 3 - Verify that a write keeps an ongoing compaction running.
+    {
+        EXPECT_TRUE(store.compactStep());
+        EXPECT_TRUE(store.isCompacting());
+        EXPECT_TRUE(store.write(0U, static_cast<std::uint32_t>(0xDEADBEEFU)));
+        EXPECT_TRUE(store.isCompacting());
+    }
+
+    // Case 4 - Compact the store, expect the dead records to be reclaimed.
+    {
+        compact(store);
+        EXPECT_EQ(store.deadSpace(), 0U);
+        EXPECT_EQ(store.freeSpace(), RegionSize / 2U - sizeof(std::uint16_t) - 6U);
+
+        std::uint32_t value{};
+        EXPECT_TRUE(store.read(0U, value));
+        EXPECT_EQ(value, 0xDEADBEEFU);
+        EXPECT_FALSE(store.contains(1U));
+        EXPECT_TRUE(store.write(1U, static_cast<std::uint16_t>(0x1234U)));
+    }
+
+    // Case 5 - Verify that the compacted bank is selected after a restart.
+    {
+        Store restarted{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(restarted.restore());
+        EXPECT_EQ(restarted.deadSpace(), 0U);
+
+        std::uint32_t value{};
+        std::uint16_t second{};
+        EXPECT_TRUE(restarted.read(0U, value));
+        EXPECT_EQ(value, 0xDEADBEEFU);
+        EXPECT_TRUE(restarted.read(1U, second));
+        EXPECT_EQ(second, 0x1234U);
+
+        // Compact once more, expect the banks to be swapped back.
+        EXPECT_TRUE(restarted.remove(1U));
+        compact(restarted);
+        Store swapped{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(swapped.restore());
+        EXPECT_TRUE(swapped.read(0U, value));
+        EXPECT_EQ(value, 0xDEADBEEFU);
+        EXPECT_FALSE(swapped.contains(1U));
+    }
+}
+
+/**
+ * @brief Key-value store tests with writes during compaction.
+ */
+TEST(Eeprom_Store, CompactionWithWrites)
+{
+    eeprom::Stub<EepromSize> eeprom{};
+    eraseRegion(eeprom);
+    Store store{eeprom, StartAddress, RegionSize};
+    EXPECT_TRUE(store.restore());
+
+    // Store three values, then change the length of the second value to create a dead record.
+    EXPECT_TRUE(store.write(0U, static_cast<std::uint32_t>(1U)));
+    EXPECT_TRUE(store.write(1U, static_cast<std::uint16_t>(2U)));
+    EXPECT_TRUE(store.write(2U, static_cast<std::uint8_t>(3U)));
+    EXPECT_TRUE(store.write(1U, static_cast<std::uint32_t>(4U)));
+    EXPECT_GT(store.deadSpace(), 0U);
+
+    // Case 1 - Start the compaction and copy the first value, then update the copied value.
+    // Expect the compaction to keep running.
+    {
+        EXPECT_TRUE(store.compactStep());
+        EXPECT_TRUE(store.compactStep());
+        EXPECT_TRUE(store.write(0U, static_cast<std::uint32_t>(0xCAFEBABEU)));
+        EXPECT_TRUE(store.isCompacting());
+    }
+
+    // Case 2 - Copy the second value, then remove it and add a value not copied yet.
+    // Expect the compaction to keep running.
+    {
+        EXPECT_TRUE(store.compactStep());
+        EXPECT_TRUE(store.remove(1U));
+        EXPECT_TRUE(store.write(3U, static_cast<std::uint8_t>(5U)));
+        EXPECT_TRUE(store.isCompacting());
+    }
+
+    // Case 3 - Complete the compaction, expect the latest values to be kept.
+    {
+        compact(store);
+        std::uint32_t first{};
+        std::uint8_t third{};
+        std::uint8_t fourth{};
+        EXPECT_TRUE(store.read(0U, first));
+        EXPECT_EQ(first, 0xCAFEBABEU);
+        EXPECT_FALSE(store.contains(1U));
+        EXPECT_TRUE(store.read(2U, third));
+        EXPECT_EQ(third, 3U);
+        EXPECT_TRUE(store.read(3U, fourth));
+        EXPECT_EQ(fourth, 5U);
+    }
+
+    // Case 4 - Verify that the latest values are restored from the compacted bank after a 
+    // restart. Expect the outdated copies to be counted as dead records.
+    {
+        Store restarted{eeprom, StartAddress, RegionSize};
+        EXPECT_TRUE(restarted.restore());
+        EXPECT_GT(restarted.deadSpace(), 0U);
+
+        std::uint32_t first{};
+        std::uint8_t third{};
+        std::uint8_t fourth{};
+        EXPECT_TRUE(restarted.read(0U, first));
+        EXPECT_EQ(first, 0xCAFEBABEU);
+        EXPECT_FALSE(restarted.contains(1U));
+        EXPECT_TRUE(restarted.read(2U, third));
+        EXPECT_EQ(third, 3U);
+        EXPECT_TRUE(restarted.read(3U, fourth));
+        EXPECT_EQ(fourth, 5U);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,135 @@
+/**
+ * @brief Unit tests for the ATmega328p power management driver.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/power/atmega328p.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+power::Interface& initPower() noexcept { return power::Atmega328p::getInstance(); }
+
+// -----------------------------------------------------------------------------
+constexpr std::uint8_t mapSleepMode(const power::SleepMode mode) noexcept
+{
+    // Map sleep mode to SMCR register value (sleep enable bit excluded).
+    switch (mode)
+    {
+        case power::SleepMode::Idle:
+            return 0U;
+        case power::SleepMode::AdcNoiseReduction:
+            return (1U << SM0);
+        case power::SleepMode::PowerDown:
+            return (1U << SM1);
+        case power::SleepMode::PowerSave:
+            return (1U << SM1) | (1U << SM0);
+        case power::SleepMode::Standby:
+            return (1U << SM2) | (1U << SM1);
+        case power::SleepMode::ExtendedStandby:
+            return (1U << SM2) | (1U << SM1) | (1U << SM0);
+        default:
+            return 0xFFU;
+    }
+}
+
+/**
+ * @brief Power management initialization test.
+ * 
+ *        Verify that the power management is initialized with idle as default sleep mode.
+ */
+TEST(Power_Atmega328p, Initialization)
+{
+    power::Interface& power{initPower()};
+
+    // Expect the power management to always be initialized, with idle as default sleep mode.
+    EXPECT_TRUE(power.isInitialized());
+    EXPECT_EQ(power.sleepMode(), power::SleepMode::Idle);
+}
+
+/**
+ * @brief Power management sleep test.
+ * 
+ *        Verify that the selected sleep mode is written on sleep, that interrupts are enabled
+ *        before entering sleep and that sleep is disabled once woken up.
+ */
+TEST(Power_Atmega328p, Sleep)
+{
+    power::Interface& power{initPower()};
+    constexpr auto modeCount{static_cast<std::uint8_t>(power::SleepMode::Count)};
+
+    // Case 1 - Enter each sleep mode, expect the SMCR register to be updated accordingly.
+    for (std::uint8_t i{}; i < modeCount; ++i)
+    {
+        const auto mode{static_cast<power::SleepMode>(i)};
+        EXPECT_TRUE(power.setSleepMode(mode));
+        EXPECT_EQ(power.sleepMode(), mode);
+
+        // Write bits of another sleep mode, as done by other drivers, and disable interrupts.
+        SMCR = mapSleepMode(power::SleepMode::ExtendedStandby);
+        utils::globalInterruptDisable();
+        power.sleep();
+
+        // Expect the sleep mode to be written, sleep to be disabled and interrupts enabled.
+        EXPECT_EQ(SMCR, mapSleepMode(mode));
+        EXPECT_TRUE(utils::read(SREG, I_FLAG));
+    }
+
+    // Case 2 - Expect invalid sleep modes to be rejected.
+    EXPECT_FALSE(power.setSleepMode(power::SleepMode::Count));
+    EXPECT_EQ(power.sleepMode(), static_cast<power::SleepMode>(modeCount - 1U));
+
+    // Restore the default sleep mode.
+    EXPECT_TRUE(power.setSleepMode(power::SleepMode::Idle));
+}
+
+/**
+ * @brief Power reduction test.
+ * 
+ *        Verify that peripherals are shut off via the power reduction register.
+ */
+TEST(Power_Atmega328p, PowerReduction)
+{
+    power::Interface& power{initPower()};
+    PRR = 0U;
+
+    // Case 1 - Shut off and re-enable the unused TWI and SPI peripherals.
+    EXPECT_TRUE(power.setPeripheralEnabled(power::Peripheral::Twi, false));
+    EXPECT_TRUE(power.setPeripheralEnabled(power::Peripheral::Spi, false));
+    EXPECT_EQ(PRR, (1U << PRTWI) | (1U << PRSPI));
+    EXPECT_FALSE(power.isPeripheralEnabled(power::Peripheral::Twi));
+    EXPECT_FALSE(power.isPeripheralEnabled(power::Peripheral::Spi));
+    EXPECT_TRUE(power.isPeripheralEnabled(power::Peripheral::Timer0));
+
+    EXPECT_TRUE(power.setPeripheralEnabled(power::Peripheral::Twi, true));
+    EXPECT_EQ(PRR, (1U << PRSPI));
+    EXPECT_TRUE(power.isPeripheralEnabled(power::Peripheral::Twi));
+
+    // Case 2 - Shut off all peripherals, expect all implemented bits to be set.
+    constexpr auto peripheralCount{static_cast<std::uint8_t>(power::Peripheral::Count)};
+    for (std::uint8_t i{}; i < peripheralCount; ++i)
+    {
+        EXPECT_TRUE(power.setPeripheralEnabled(static_cast<power::Peripheral>(i), false));
+    }
+    EXPECT_EQ(PRR, (1U << PRADC) | (1U << PRUSART0) | (1U << PRSPI) | (1U << PRTIM1) 
+        | (1U << PRTIM0) | (1U << PRTIM2) | (1U << PRTWI));
+
+    // Case 3 - Expect invalid peripherals to be rejected.
+    EXPECT_FALSE(power.setPeripheralEnabled(power::Peripheral::Count, true));
+    EXPECT_FALSE(power.isPeripheralEnabled(power::Peripheral::Count));
+
+    // Restore the power reduction register.
+    PRR = 0U;
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
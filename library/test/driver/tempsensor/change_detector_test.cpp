@@ -0,0 +1,121 @@
+/**
+ * @brief Unit tests for the temperature change detector.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/tempsensor/change_detector.h"
+#include "driver/tempsensor/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** Trigger constants. */
+using Trigger = tempsensor::ChangeDetector::Trigger;
+
+// -----------------------------------------------------------------------------
+std::uint8_t sample(tempsensor::ChangeDetector& detector, tempsensor::Stub& sensor, 
+                    const std::int16_t temperature) noexcept
+{
+    // Sample the given temperature, acknowledge the report if triggered.
+    sensor.setTemperature(temperature);
+    const std::uint8_t trigger{detector.update(sensor)};
+    if (Trigger::None != trigger) { detector.acknowledge(); }
+    return trigger;
+}
+
+/**
+ * @brief Deadband and hysteresis test.
+ * 
+ *        Verify that changes are only reported when exceeding the deadband, and that reversed
+ *        changes must exceed the deadband by the hysteresis.
+ */
+TEST(TempSensor_ChangeDetector, Deadband)
+{
+    tempsensor::Stub sensor{};
+    tempsensor::ChangeDetector detector{};
+
+    // Case 1 - Take the first sample, expect it to be reported.
+    {
+        EXPECT_EQ(sample(detector, sensor, 20), Trigger::Initial);
+        EXPECT_EQ(detector.reported(), 20);
+    }
+
+    // Case 2 - Change within the deadband, expect no report.
+    {
+        EXPECT_EQ(sample(detector, sensor, 21), Trigger::None);
+        EXPECT_EQ(sample(detector, sensor, 20), Trigger::None);
+        EXPECT_EQ(sample(detector, sensor, 19), Trigger::None);
+    }
+
+    // Case 3 - Change beyond the deadband, expect a report.
+    {
+        EXPECT_EQ(sample(detector, sensor, 22), Trigger::Deadband);
+        EXPECT_EQ(detector.reported(), 22);
+    }
+
+    // Case 4 - Reverse the change, expect the hysteresis to be added to the deadband.
+    {
+        EXPECT_EQ(sample(detector, sensor, 20), Trigger::None);
+        EXPECT_EQ(sample(detector, sensor, 19), Trigger::Deadband);
+    }
+
+    // Case 5 - Continue in the same direction, expect the deadband only.
+    {
+        EXPECT_EQ(sample(detector, sensor, 17), Trigger::Deadband);
+        EXPECT_EQ(detector.reported(), 17);
+    }
+}
+
+/**
+ * @brief Rate and silence test.
+ * 
+ *        Verify that fast changes are reported immediately and that stable readings are 
+ *        reported once per silence interval.
+ */
+TEST(TempSensor_ChangeDetector, RateAndSilence)
+{
+    constexpr std::uint16_t maxSilence{5U};
+    tempsensor::Stub sensor{};
+    tempsensor::ChangeDetector detector{};
+    detector.setConfig({5U, 0U, 3U, maxSilence});
+    EXPECT_EQ(sample(detector, sensor, 20), Trigger::Initial);
+
+    // Case 1 - Change fast within the deadband, expect a rate report.
+    {
+        EXPECT_EQ(sample(detector, sensor, 23), Trigger::Rate);
+        EXPECT_EQ(sample(detector, sensor, 24), Trigger::None);
+    }
+
+    // Case 2 - Keep the temperature stable, expect one report per silence interval.
+    {
+        for (std::uint16_t i{2U}; i < maxSilence; ++i) 
+        { 
+            EXPECT_EQ(sample(detector, sensor, 24), Trigger::None); 
+        }
+        EXPECT_EQ(sample(detector, sensor, 24), Trigger::Silence);
+        EXPECT_EQ(sample(detector, sensor, 24), Trigger::None);
+    }
+
+    // Case 3 - Don't acknowledge a report, expect the first trigger to stay pending.
+    {
+        sensor.setTemperature(40);
+        EXPECT_EQ(detector.update(sensor), Trigger::Deadband);
+        EXPECT_EQ(detector.update(sensor), Trigger::Deadband);
+        EXPECT_EQ(detector.pending(), Trigger::Deadband);
+        EXPECT_EQ(detector.temperature(), 40);
+        EXPECT_EQ(detector.reported(), 24);
+
+        detector.acknowledge();
+        EXPECT_EQ(detector.pending(), Trigger::None);
+        EXPECT_EQ(detector.reported(), 40);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
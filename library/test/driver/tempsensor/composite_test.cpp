@@ -0,0 +1,140 @@
+/**
+ * @brief Unit tests for the composite temperature sensor.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/tempsensor/composite.h"
+#include "driver/tempsensor/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief Composite sensor fusion test.
+ * 
+ *        Verify that the readings are fused by median, trimmed mean and weighted mean, and 
+ *        that each sensor is read once per read.
+ */
+TEST(TempSensor_Composite, Fusion)
+{
+    tempsensor::Stub sensors[5U];
+    tempsensor::Composite<5U> composite{sensors[0U], sensors[1U], sensors[2U], sensors[3U], 
+                                        sensors[4U]};
+    const std::int16_t temperatures[]{20, 22, 21, 25, 30};
+    for (std::uint8_t i{}; i < composite.size(); ++i) 
+    { 
+        sensors[i].setTemperature(temperatures[i]); 
+    }
+    EXPECT_TRUE(composite.isInitialized());
+
+    // Case 1 - Fuse by median, expect each sensor to be read once.
+    {
+        EXPECT_EQ(composite.read(), 22);
+        EXPECT_EQ(composite.healthyCount(), 5U);
+        for (const auto& sensor : sensors) { EXPECT_EQ(sensor.readCount(), 1U); }
+    }
+
+    // Case 2 - Fuse by trimmed mean, expect the lowest and highest readings to be excluded.
+    {
+        composite.setFusion(tempsensor::Fusion::TrimmedMean);
+        EXPECT_EQ(composite.read(), 23);
+
+        // Trim too many readings, expect the median to be used instead.
+        composite.setTrimCount(2U);
+        EXPECT_EQ(composite.read(), 22);
+    }
+
+    // Case 3 - Fuse by weighted mean, expect the heavy sensors to dominate.
+    {
+        composite.setFusion(tempsensor::Fusion::Weighted);
+        EXPECT_EQ(composite.read(), 24);
+
+        for (std::uint8_t i{}; i < composite.size(); ++i) { composite.setWeight(i, 0U); }
+        EXPECT_TRUE(composite.setWeight(0U, 3U));
+        EXPECT_TRUE(composite.setWeight(1U, 1U));
+        EXPECT_FALSE(composite.setWeight(composite.size(), 1U));
+        EXPECT_EQ(composite.read(), 21);
+    }
+}
+
+/**
+ * @brief Composite sensor health test.
+ * 
+ *        Verify that outliers and uninitialized sensors are excluded from the fused reading
+ *        and flagged in the sensor health.
+ */
+TEST(TempSensor_Composite, Health)
+{
+    tempsensor::Stub sensors[4U];
+    tempsensor::Composite<4U> composite{sensors[0U], sensors[1U], sensors[2U], sensors[3U]};
+    const std::int16_t temperatures[]{20, 21, 22, 85};
+    for (std::uint8_t i{}; i < composite.size(); ++i) 
+    { 
+        sensors[i].setTemperature(temperatures[i]); 
+    }
+
+    // Case 1 - Read without outlier rejection, expect the outlier to affect the median.
+    {
+        EXPECT_EQ(composite.read(), 22);
+        EXPECT_EQ(composite.health(3U), tempsensor::Health::Ok);
+    }
+
+    // Case 2 - Enable outlier rejection, expect the outlier to be rejected.
+    {
+        composite.setOutlierThreshold(5U);
+        EXPECT_EQ(composite.read(), 21);
+        EXPECT_EQ(composite.healthyCount(), 3U);
+        EXPECT_EQ(composite.health(3U), tempsensor::Health::Outlier);
+        EXPECT_EQ(composite.sample(3U), 85);
+    }
+
+    // Case 3 - Read widely spread readings with a tight threshold, expect all readings to be 
+    //          rejected and the default temperature.
+    {
+        const std::int16_t spread[]{0, 10, 14, 30};
+        for (std::uint8_t i{}; i < composite.size(); ++i) { sensors[i].setTemperature(spread[i]); }
+        composite.setOutlierThreshold(1U);
+        EXPECT_EQ(composite.read(), 0);
+        EXPECT_EQ(composite.healthyCount(), 0U);
+        for (std::uint8_t i{}; i < composite.size(); ++i) 
+        { 
+            EXPECT_EQ(composite.health(i), tempsensor::Health::Outlier); 
+        }
+
+        // Restore the readings and the threshold.
+        for (std::uint8_t i{}; i < composite.size(); ++i) 
+        { 
+            sensors[i].setTemperature(temperatures[i]); 
+        }
+        composite.setOutlierThreshold(5U);
+    }
+
+    // Case 4 - Uninitialize a sensor, expect it to be skipped and too few readings remaining 
+    //          for outlier rejection.
+    {
+        sensors[0U].setInitialized(false);
+        sensors[1U].setInitialized(false);
+        EXPECT_EQ(composite.read(), 54);
+        EXPECT_EQ(composite.health(0U), tempsensor::Health::NotInitialized);
+        EXPECT_EQ(composite.health(3U), tempsensor::Health::Ok);
+        EXPECT_EQ(sensors[0U].readCount(), 3U);
+    }
+
+    // Case 5 - Uninitialize all sensors, expect the default temperature.
+    {
+        for (auto& sensor : sensors) { sensor.setInitialized(false); }
+        EXPECT_FALSE(composite.isInitialized());
+        EXPECT_EQ(composite.read(), 0);
+        EXPECT_EQ(composite.healthyCount(), 0U);
+        EXPECT_EQ(composite.health(composite.size()), tempsensor::Health::NotInitialized);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,118 @@
+/**
+ * @brief Unit tests for the Kalman filtered temperature sensor.
+ */
+#include <cstdint>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "driver/tempsensor/kalman.h"
+#include "driver/tempsensor/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief Kalman filter smoothing test.
+ * 
+ *        Verify that noisy readings are smoothed and that the estimate follows a step change.
+ */
+TEST(TempSensor_Kalman, Smoothing)
+{
+    tempsensor::Stub sensor{};
+    tempsensor::Kalman filter{sensor};
+    EXPECT_TRUE(filter.isInitialized());
+
+    // Case 1 - Read the first sample, expect it to initialize the estimate.
+    {
+        sensor.setTemperature(20);
+        EXPECT_EQ(filter.read(), 20);
+        EXPECT_EQ(filter.variance(), filter.measurementNoise());
+    }
+
+    // Case 2 - Read noisy samples around 20 degrees, expect the estimate to settle within one
+    //          degree of 20 degrees once the gain has converged.
+    {
+        constexpr std::uint8_t settleCount{8U};
+        const std::int16_t noise[]{3, -2, 2, -3, 1, -1, 3, -3};
+        for (std::uint8_t i{}; i < 40U; ++i)
+        {
+            sensor.setTemperature(20 + noise[i % 8U]);
+            const std::int16_t temperature{filter.read()};
+            EXPECT_LE(std::abs(temperature - 20), settleCount <= i ? 1 : 2);
+        }
+
+        // Expect the variance to have converged below the measurement noise.
+        EXPECT_LT(filter.variance(), filter.measurementNoise());
+        EXPECT_GE(filter.variance(), filter.processNoise() / 2U);
+    }
+
+    // Case 3 - Step the temperature, expect the estimate to follow monotonically.
+    {
+        sensor.setTemperature(30);
+        std::int16_t previous{filter.read()};
+        EXPECT_GT(previous, 20);
+        EXPECT_LT(previous, 30);
+
+        for (std::uint8_t i{}; i < 30U; ++i)
+        {
+            const std::int16_t temperature{filter.read()};
+            EXPECT_GE(temperature, previous);
+            previous = temperature;
+        }
+        EXPECT_EQ(previous, 30);
+    }
+
+    // Case 4 - Follow a negative temperature, expect correct rounding below zero.
+    {
+        filter.reset();
+        sensor.setTemperature(-15);
+        EXPECT_EQ(filter.read(), -15);
+        EXPECT_EQ(filter.estimate(), -15 * (1L << tempsensor::Kalman::Shift));
+    }
+}
+
+/**
+ * @brief Kalman filter tuning test.
+ * 
+ *        Verify that the noise parameters can be tuned at runtime and that an uninitialized 
+ *        sensor isn't read.
+ */
+TEST(TempSensor_Kalman, Tuning)
+{
+    tempsensor::Stub sensor{};
+    tempsensor::Kalman filter{sensor};
+    sensor.setTemperature(20);
+    EXPECT_EQ(filter.read(), 20);
+
+    // Case 1 - Disable the measurement noise, expect the estimate to follow the readings.
+    {
+        filter.setMeasurementNoise(0U);
+        EXPECT_EQ(filter.measurementNoise(), 0U);
+        sensor.setTemperature(25);
+        EXPECT_EQ(filter.read(), 25);
+    }
+
+    // Case 2 - Disable the process noise, expect the estimate to ignore further changes.
+    {
+        filter.setMeasurementNoise(tempsensor::Kalman::DefaultMeasurementNoise);
+        filter.setProcessNoise(0U);
+        EXPECT_EQ(filter.processNoise(), 0U);
+        sensor.setTemperature(35);
+        for (std::uint8_t i{}; i < 10U; ++i) { EXPECT_EQ(filter.read(), 25); }
+    }
+
+    // Case 3 - Uninitialize the sensor, expect the default temperature.
+    {
+        sensor.setInitialized(false);
+        EXPECT_FALSE(filter.isInitialized());
+        EXPECT_EQ(filter.read(), 0);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
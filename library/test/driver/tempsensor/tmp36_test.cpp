@@ -26,6 +26,14 @@ constexpr double computeInputVoltage(const std::uint16_t adcVal) noexcept
     return static_cast<double>(adcVal) / adcMax * supplyVoltage;
 }
 
+// -----------------------------------------------------------------------------
+constexpr double computeInputVoltage(const std::uint16_t adcVal, const std::uint16_t adcMax, 
+                                     const double supplyVoltage) noexcept
+{
+    // Convert the ADC value to a voltage.
+    return static_cast<double>(adcVal) / adcMax * supplyVoltage;
+}
+
 // -----------------------------------------------------------------------------
 constexpr std::int16_t convertToTemp(const double inputVoltage) noexcept
 {
@@ -131,6 +139,39 @@ TEST(TempSensor_Tmp36, Accuracy)
         EXPECT_EQ(tempSensor->read(), expectedTemp);
     }
 }
+
+/**
+ * @brief Temp sensor integer conversion test.
+ * 
+ *        Verify that the integer conversion gives the same result as the floating-point 
+ *        conversion T = 100 * Uin - 50 for every ADC value, resolution and supply voltage.
+ */
+TEST(TempSensor_Tmp36, IntegerConversion)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    constexpr std::uint8_t resolutions[]{8U, 10U};
+    constexpr double supplyVoltages[]{1.1, 3.3, 5.0};
+
+    for (const auto& resolution : resolutions)
+    {
+        for (const auto& supplyVoltage : supplyVoltages)
+        {
+            // Set up the ADC and the temp sensor.
+            adc::Stub adc{resolution, supplyVoltage};
+            tempsensor::Tmp36 tempSensor{tempSensorPin, adc};
+            EXPECT_TRUE(tempSensor.isInitialized());
+
+            // Expect the temperature to match the floating-point result for all ADC values.
+            for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); ++adcVal)
+            {
+                const double inputVoltage{
+                    computeInputVoltage(adcVal, adc.maxValue(), supplyVoltage)};
+                adc.setValue(adcVal);
+                EXPECT_EQ(tempSensor.read(), convertToTemp(inputVoltage));
+            }
+        }
+    }
+}
 } // namespace
 } // namespace driver
 
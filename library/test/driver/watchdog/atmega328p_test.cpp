@@ -14,6 +14,12 @@
 
 namespace driver
 {
+namespace watchdog
+{
+/** Watchdog interrupt service routine, which invokes the timeout callback. */
+void WDT_vect() noexcept;
+} // namespace watchdog
+
 namespace
 {
 using Timeout = watchdog::Atmega328p::Timeout;
@@ -176,6 +182,77 @@ TEST(Watchdog_Atmega328p, Timeout)
         }
     }
 }
+
+/** The number of times the timeout callback has been invoked. */
+std::uint8_t myTimeoutCount{};
+
+// -----------------------------------------------------------------------------
+void timeoutCallback() noexcept { myTimeoutCount++; }
+
+/**
+ * @brief Watchdog timer interrupt test.
+ * 
+ *        Verify that the watchdog runs in interrupt and system reset mode when a timeout 
+ *        callback is set, and that the callback is invoked on timeout.
+ */
+TEST(Watchdog_Atmega328p, TimeoutCallback)
+{
+    watchdog::Interface& watchdog{initWatchdog()};
+    myTimeoutCount = 0U;
+
+    // Case 1 - Enable the watchdog without callback, expect system reset mode only.
+    {
+        watchdog.setTimeoutCallback(nullptr);
+        watchdog.setEnabled(true);
+        EXPECT_TRUE(utils::read(WDTCSR, WDE));
+        EXPECT_FALSE(utils::read(WDTCSR, WDIE));
+
+        watchdog::WDT_vect();
+        EXPECT_EQ(myTimeoutCount, 0U);
+    }
+
+    // Case 2 - Set a callback while enabled, expect interrupt and system reset mode.
+    // Expect the callback to be invoked on timeout.
+    {
+        watchdog.setTimeoutCallback(timeoutCallback);
+        EXPECT_TRUE(utils::read(WDTCSR, WDE));
+        EXPECT_TRUE(utils::read(WDTCSR, WDIE));
+
+        watchdog::WDT_vect();
+        EXPECT_EQ(myTimeoutCount, 1U);
+    }
+
+    // Case 3 - Simulate that the watchdog interrupt is disabled by hardware on timeout, then
+    // reset the watchdog, i.e. the system has recovered.
+    // Expect the interrupt to be re-armed, so the callback is invoked on the next timeout.
+    {
+        utils::clear(WDTCSR, WDIE);
+        watchdog.reset();
+        EXPECT_TRUE(utils::read(WDTCSR, WDE));
+        EXPECT_TRUE(utils::read(WDTCSR, WDIE));
+
+        watchdog::WDT_vect();
+        EXPECT_EQ(myTimeoutCount, 2U);
+    }
+
+    // Case 4 - Remove the callback, then reset the watchdog.
+    // Expect the interrupt to stay disabled, i.e. system reset mode only.
+    {
+        watchdog.setTimeoutCallback(nullptr);
+        watchdog.reset();
+        EXPECT_TRUE(utils::read(WDTCSR, WDE));
+        EXPECT_FALSE(utils::read(WDTCSR, WDIE));
+        watchdog.setTimeoutCallback(timeoutCallback);
+    }
+
+    // Case 5 - Disable the watchdog, expect both the interrupt and system reset to be disabled.
+    {
+        watchdog.setEnabled(false);
+        EXPECT_FALSE(utils::read(WDTCSR, WDE));
+        EXPECT_FALSE(utils::read(WDTCSR, WDIE));
+        watchdog.setTimeoutCallback(nullptr);
+    }
+}
 } // namespace
 } // namespace driver.
 
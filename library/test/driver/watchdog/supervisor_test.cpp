@@ -0,0 +1,108 @@
+/**
+ * @brief Unit tests for the task-aware watchdog supervisor.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/watchdog/stub.h"
+#include "driver/watchdog/supervisor.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief Watchdog supervisor test.
+ * 
+ *        Verify that the watchdog is only reset while all supervised tasks check in within
+ *        their deadlines.
+ */
+TEST(Watchdog_Supervisor, Deadlines)
+{
+    watchdog::Stub watchdog{};
+    watchdog::Supervisor supervisor{watchdog};
+    constexpr std::uint8_t fastTask{0U};
+    constexpr std::uint8_t slowTask{5U};
+
+    // Case 1 - Verify that calls are forwarded to the supervised watchdog.
+    {
+        EXPECT_TRUE(supervisor.isInitialized());
+        supervisor.setEnabled(true);
+        EXPECT_TRUE(watchdog.isEnabled());
+        EXPECT_TRUE(supervisor.setTimeout_ms(512U));
+        EXPECT_EQ(watchdog.timeout_ms(), 512U);
+
+        // Expect the watchdog to be reset when no tasks are supervised.
+        supervisor.reset();
+        EXPECT_EQ(watchdog.resetCount(), 1U);
+    }
+
+    // Case 2 - Verify that invalid tasks are rejected.
+    {
+        EXPECT_FALSE(supervisor.addTask(watchdog::Supervisor::MaxTaskCount, 1U));
+        EXPECT_FALSE(supervisor.addTask(fastTask, 0U));
+        EXPECT_EQ(supervisor.taskMask(), 0U);
+    }
+
+    // Case 3 - Add tasks, expect the watchdog to be reset while the tasks check in.
+    {
+        EXPECT_TRUE(supervisor.addTask(fastTask, 1U));
+        EXPECT_TRUE(supervisor.addTask(slowTask, 3U));
+        EXPECT_EQ(supervisor.taskMask(), (1U << fastTask) | (1U << slowTask));
+
+        for (std::uint8_t i{}; i < 10U; ++i)
+        {
+            supervisor.checkIn(fastTask);
+            if (0U == i % 3U) { supervisor.checkIn(slowTask); }
+            supervisor.tick();
+            supervisor.checkIn(fastTask);
+            supervisor.reset();
+        }
+        EXPECT_EQ(supervisor.expiredMask(), 0U);
+        EXPECT_EQ(supervisor.missedTask(), -1);
+        EXPECT_EQ(watchdog.resetCount(), 11U);
+    }
+
+    // Case 4 - Stop checking in the slow task, expect it to expire once its deadline has passed.
+    // Expect the watchdog to no longer be reset.
+    {
+        supervisor.checkIn(slowTask);
+        for (std::uint8_t i{}; i < 3U; ++i)
+        {
+            supervisor.tick();
+            supervisor.checkIn(fastTask);
+        }
+        EXPECT_EQ(supervisor.expiredMask(), 0U);
+
+        supervisor.tick();
+        supervisor.checkIn(fastTask);
+        EXPECT_EQ(supervisor.expiredMask(), 1U << slowTask);
+        EXPECT_EQ(supervisor.missedTask(), slowTask);
+
+        supervisor.reset();
+        EXPECT_EQ(watchdog.resetCount(), 11U);
+
+        // Expect the expired task to remain latched after a late check-in.
+        supervisor.checkIn(slowTask);
+        supervisor.reset();
+        EXPECT_EQ(supervisor.missedTask(), slowTask);
+        EXPECT_EQ(watchdog.resetCount(), 11U);
+    }
+
+    // Case 5 - Remove the expired task, expect the watchdog to be reset again.
+    {
+        supervisor.removeTask(slowTask);
+        EXPECT_EQ(supervisor.taskMask(), 1U << fastTask);
+        EXPECT_EQ(supervisor.expiredMask(), 0U);
+
+        supervisor.reset();
+        EXPECT_EQ(watchdog.resetCount(), 12U);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
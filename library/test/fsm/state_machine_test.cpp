@@ -0,0 +1,168 @@
+/**
+ * @brief Unit tests for the table-driven hierarchical state machine.
+ */
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "fsm/state_machine.h"
+
+#ifdef TESTSUITE
+
+namespace fsm
+{
+namespace
+{
+/**
+ * @brief Structure holding the context of the test state machine.
+ */
+struct Context
+{
+    /** Log of performed actions (uppercase = entry, lowercase = exit or transition action). */
+    std::string log;
+
+    /** Indicate whether guarded transitions are enabled. */
+    bool enabled;
+};
+
+/**
+ * @brief Structure of test states.
+ */
+struct TestState
+{
+    static constexpr std::uint8_t Root{0U};
+    static constexpr std::uint8_t A{1U};
+    static constexpr std::uint8_t A1{2U};
+    static constexpr std::uint8_t A2{3U};
+    static constexpr std::uint8_t B{4U};
+    static constexpr std::uint8_t Count{5U};
+};
+
+/**
+ * @brief Structure of test events.
+ */
+struct TestEvent
+{
+    static constexpr std::uint8_t Next{0U};
+    static constexpr std::uint8_t Jump{1U};
+    static constexpr std::uint8_t Tick{2U};
+    static constexpr std::uint8_t Guarded{3U};
+    static constexpr std::uint8_t Count{4U};
+};
+
+// -----------------------------------------------------------------------------
+template <char Id>
+void log(Context& context) noexcept { context.log += Id; }
+
+// -----------------------------------------------------------------------------
+bool isEnabled(Context& context) noexcept { return context.enabled; }
+
+/** States of the test state machine, indexed by state ID. */
+constexpr State<Context> States[TestState::Count]
+{
+    {None,            log<'R'>, log<'r'>}, // Root.
+    {TestState::Root, log<'A'>, log<'a'>}, // A.
+    {TestState::A,    log<'C'>, log<'c'>}, // A1.
+    {TestState::A,    log<'D'>, log<'d'>}, // A2.
+    {TestState::Root, log<'B'>, log<'b'>}, // B.
+};
+
+/** Transitions of the test state machine. */
+constexpr Transition<Context> Transitions[]
+{
+    {TestState::A1,   TestEvent::Next,    TestState::A2, nullptr,   log<'n'>},
+    {TestState::A2,   TestEvent::Next,    TestState::A1, nullptr,   log<'n'>},
+    {TestState::A,    TestEvent::Jump,    TestState::B,  nullptr,   nullptr},
+    {TestState::B,    TestEvent::Jump,    TestState::A1, nullptr,   nullptr},
+    {TestState::Root, TestEvent::Tick,    None,          nullptr,   log<'t'>},
+    {TestState::B,    TestEvent::Guarded, TestState::A2, isEnabled, nullptr},
+    {TestState::B,    TestEvent::Guarded, None,          nullptr,   log<'x'>},
+    {TestState::A2,   TestEvent::Guarded, TestState::A2, nullptr,   nullptr},
+};
+
+/** Compiled tables of the test state machine. */
+constexpr auto Tables{makeTable<TestEvent::Count>(States, Transitions)};
+static_assert(Tables.isValid(), "Invalid state machine tables!");
+
+// -----------------------------------------------------------------------------
+std::string takeLog(Context& context)
+{
+    const std::string log{context.log};
+    context.log.clear();
+    return log;
+}
+
+/**
+ * @brief State machine transition test.
+ * 
+ *        Verify that events are handled by the innermost state with an enabled transition,
+ *        and that the states are exited and entered in the correct order.
+ */
+TEST(Fsm_StateMachine, Transitions)
+{
+    Context context{};
+    StateMachine<Context> machine{Tables, context};
+
+    // Case 1 - Expect events to be ignored before the state machine is started.
+    {
+        EXPECT_FALSE(machine.isStarted());
+        EXPECT_FALSE(machine.dispatch(TestEvent::Next));
+        EXPECT_FALSE(machine.start(TestState::Count));
+    }
+
+    // Case 2 - Start the state machine, expect the states to be entered outermost first.
+    {
+        EXPECT_TRUE(machine.start(TestState::A1));
+        EXPECT_EQ(machine.state(), TestState::A1);
+        EXPECT_EQ(takeLog(context), "RAC");
+    }
+
+    // Case 3 - Transition between sibling states, expect their parent to stay active.
+    {
+        EXPECT_TRUE(machine.dispatch(TestEvent::Next));
+        EXPECT_EQ(machine.state(), TestState::A2);
+        EXPECT_EQ(takeLog(context), "cnD");
+        EXPECT_TRUE(machine.isIn(TestState::A));
+    }
+
+    // Case 4 - Dispatch an event handled by the parent state, expect both to be exited.
+    {
+        EXPECT_TRUE(machine.dispatch(TestEvent::Jump));
+        EXPECT_EQ(machine.state(), TestState::B);
+        EXPECT_EQ(takeLog(context), "daB");
+        EXPECT_FALSE(machine.isIn(TestState::A));
+    }
+
+    // Case 5 - Expect internal transitions to leave the state unchanged, and unhandled events
+    // to be ignored.
+    {
+        EXPECT_TRUE(machine.dispatch(TestEvent::Tick));
+        EXPECT_FALSE(machine.dispatch(TestEvent::Next));
+        EXPECT_FALSE(machine.dispatch(TestEvent::Count));
+        EXPECT_EQ(machine.state(), TestState::B);
+        EXPECT_EQ(takeLog(context), "t");
+    }
+
+    // Case 6 - Expect the first transition with an enabled guard to be taken.
+    {
+        EXPECT_TRUE(machine.dispatch(TestEvent::Guarded));
+        EXPECT_EQ(takeLog(context), "x");
+
+        context.enabled = true;
+        EXPECT_TRUE(machine.dispatch(TestEvent::Guarded));
+        EXPECT_EQ(machine.state(), TestState::A2);
+        EXPECT_EQ(takeLog(context), "bAD");
+    }
+
+    // Case 7 - Expect self-transitions to exit and re-enter the state.
+    {
+        EXPECT_TRUE(machine.dispatch(TestEvent::Guarded));
+        EXPECT_EQ(machine.state(), TestState::A2);
+        EXPECT_EQ(takeLog(context), "dD");
+    }
+}
+} // namespace
+} // namespace fsm
+
+#endif /** TESTSUITE */
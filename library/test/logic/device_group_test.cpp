@@ -0,0 +1,78 @@
+/**
+ * @brief Unit tests for the device groups.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "logic/device_group.h"
+
+#ifdef TESTSUITE
+
+namespace logic
+{
+namespace
+{
+/**
+ * @brief Test device holding an output.
+ */
+struct Device
+{
+    /** The output of the device. */
+    bool output{false};
+
+    /** The number of writes to the device. */
+    std::uint8_t writeCount{};
+
+    // -----------------------------------------------------------------------------
+    bool read() const noexcept { return output; }
+
+    // -----------------------------------------------------------------------------
+    void write(const bool value) noexcept 
+    { 
+        output = value; 
+        writeCount++;
+    }
+};
+
+/**
+ * @brief Device group test.
+ * 
+ *        Verify that methods are called on each device in the group.
+ */
+TEST(Logic_DeviceGroup, Dispatch)
+{
+    constexpr std::uint8_t deviceCount{3U};
+    Device devices[deviceCount]{};
+    const DeviceGroup<Device, deviceCount> group{devices[0U], devices[1U], devices[2U]};
+
+    // Case 1 - Verify that the group refers to the given devices.
+    {
+        static_assert(deviceCount == group.size(), "Unexpected group size!");
+        for (std::uint8_t i{}; i < deviceCount; ++i) { EXPECT_EQ(&group[i], &devices[i]); }
+    }
+
+    // Case 2 - Write to all devices, expect each device to be written once.
+    {
+        EXPECT_FALSE(group.any<&Device::read>());
+        group.forEach<&Device::write>(true);
+
+        for (const auto& device : devices) 
+        { 
+            EXPECT_TRUE(device.output); 
+            EXPECT_EQ(device.writeCount, 1U);
+        }
+        EXPECT_TRUE(group.all<&Device::read>());
+    }
+
+    // Case 3 - Clear one device, expect some but not all devices to be set.
+    {
+        group[1U].write(false);
+        EXPECT_TRUE(group.any<&Device::read>());
+        EXPECT_FALSE(group.all<&Device::read>());
+    }
+}
+} // namespace
+} // namespace logic
+
+#endif /** TESTSUITE */
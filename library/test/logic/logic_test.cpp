@@ -11,15 +11,13 @@
 
 #include "driver/eeprom/stub.h"
 #include "driver/gpio/stub.h"
+#include "driver/power/stub.h"
 #include "driver/serial/stub.h"
 #include "driver/tempsensor/stub.h"
 #include "driver/timer/stub.h"
 #include "driver/watchdog/stub.h"
 #include "logic/stub.h"
 
-//! @todo Remove this #ifdef block once all stubs are implemented!
-#ifdef STUBS_IMPLEMENTED
-
 #ifdef TESTSUITE
 
 namespace logic
@@ -52,8 +50,8 @@ struct Mock final
     /** Toggle timer stub. */
     driver::timer::Stub toggleTimer;
 
-    /** Temperature timer stub. */
-    driver::timer::Stub tempTimer;
+    /** Tick timer stub. */
+    driver::timer::Stub tickTimer;
 
     /** Serial driver stub. */
     driver::serial::Stub serial;
@@ -67,6 +65,9 @@ struct Mock final
     /** Temperature sensor stub. */
     driver::tempsensor::Stub tempSensor;
 
+    /** Power management stub. */
+    driver::power::Stub power;
+
     /** Logic implementation stub. */
     std::unique_ptr<logic::Stub> logicImpl;
 
@@ -79,11 +80,12 @@ struct Mock final
         , tempButton{}
         , debounceTimer{}
         , toggleTimer{}
-        , tempTimer{}
+        , tickTimer{}
         , serial{}
         , watchdog{}
         , eeprom{}
         , tempSensor{}
+        , power{}
         , logicImpl{nullptr}
     {}
 
@@ -100,8 +102,9 @@ struct Mock final
     logic::Interface& createLogic()
     {
         logicImpl = std::make_unique<logic::Stub>(
-            led, toggleButton, tempButton, debounceTimer, toggleTimer, 
-            tempTimer, serial, watchdog, eeprom, tempSensor);
+            Logic::LedGroup{led}, Logic::ToggleButtonGroup{toggleButton}, 
+            Logic::TempButtonGroup{tempButton}, debounceTimer, toggleTimer, tickTimer, serial, 
+            watchdog, eeprom, Logic::TempSensorGroup{tempSensor}, power);
         return *logicImpl;
     }
 
@@ -146,6 +149,89 @@ private:
     }
 };
 
+/**
+ * @brief Temperature sensor simulating tick timer interrupts while it's being read.
+ * 
+ *        The system is stopped once the sensor has been read, i.e. after the task reading the 
+ *        sensor has been run.
+ */
+class TickingSensor final : public driver::tempsensor::Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] tickTimer Tick timer stub to simulate timeouts with.
+     * @param[in] stop Stop flag to set once the sensor has been read.
+     */
+    TickingSensor(driver::timer::Stub& tickTimer, bool& stop) noexcept
+        : myTickTimer{tickTimer}
+        , myStop{stop}
+        , myLogic{nullptr}
+        , myTickCount{}
+    {}
+
+    /**
+     * @brief Destructor.
+     */
+    ~TickingSensor() noexcept override = default;
+
+    /**
+     * @brief Set the logic to simulate tick timer interrupts for.
+     * 
+     * @param[in] logic The logic implementation.
+     * @param[in] tickCount The number of ticks to simulate on each read.
+     */
+    void attach(logic::Interface& logic, const std::uint8_t tickCount) noexcept
+    {
+        myLogic     = &logic;
+        myTickCount = tickCount;
+    }
+
+    /**
+     * @brief Check if the temperature sensor is initialized.
+     * 
+     * @return True (the sensor is always initialized).
+     */
+    bool isInitialized() const noexcept override { return true; }
+
+    /**
+     * @brief Read the temperature sensor.
+     * 
+     *        Simulate tick timer interrupts during the read, then stop the system.
+     * 
+     * @return The temperature in degrees Celsius.
+     */
+    std::int16_t read() const noexcept override
+    {
+        for (std::uint8_t i{}; (nullptr != myLogic) && (i < myTickCount); ++i)
+        {
+            myTickTimer.setTimedOut(true);
+            myLogic->handleTickTimerTimeout();
+        }
+        myStop = true;
+        return 25;
+    }
+
+    TickingSensor(const TickingSensor&)            = delete; // No copy constructor.
+    TickingSensor(TickingSensor&&)                 = delete; // No move constructor.
+    TickingSensor& operator=(const TickingSensor&) = delete; // No copy assignment.
+    TickingSensor& operator=(TickingSensor&&)      = delete; // No move assignment.
+
+private:
+    /** Tick timer stub to simulate timeouts with. */
+    driver::timer::Stub& myTickTimer;
+
+    /** Stop flag to set once the sensor has been read. */
+    bool& myStop;
+
+    /** The logic implementation to simulate tick timer interrupts for. */
+    logic::Interface* myLogic;
+
+    /** The number of ticks to simulate on each read. */
+    std::uint8_t myTickCount;
+};
+
 /**
  * @brief Debounce handling test.
  *
@@ -246,7 +332,7 @@ TEST(Logic, ToggleHandling)
         //! @note Don't forget to simulate the debounce timer timeout after the button event.
     }
 
-    // Case 7 - Simulate temperature timer timeout, expect the LED to be unaffected.
+    // Case 7 - Simulate tick timer timeout, expect the LED to be unaffected.
     {
     }
 
@@ -264,7 +350,7 @@ TEST(Logic, TempHandling)
 {
     // Create logic implementation and run the system.
     
-    // Expect the temperature timer to be enabled at the start.
+    // Expect the tick timer to be enabled at the start.
 
     // Set the temperature to 25 degrees Celsius.
 
@@ -280,7 +366,7 @@ TEST(Logic, TempHandling)
         //! @note Don't forget to simulate the debounce timer timeout after the button event.
     }
 
-    // Case 3 - Simulate temperature timer timeout.
+    // Case 3 - Simulate tick timer timeouts until the temperature period has elapsed.
     // Expect the temperature to be printed once more.
     {
     }
@@ -312,10 +398,105 @@ TEST(Logic, Eeprom)
         // Verify that the toggle timer was enabled during initialization.
     }
 }
+
+/**
+ * @brief Event queue test.
+ *
+ *        Verify that posted events are queued until they're handled by the run loop.
+ */
+TEST(Logic, EventQueue)
+{
+    // Create logic implementation, keep the toggle button pressed.
+    Mock mock{};
+    logic::Interface& logic{mock.createLogic()};
+    mock.toggleButton.write(true);
+
+    // Case 1 - Post a button event, expect it not to be handled until the system runs.
+    {
+        EXPECT_TRUE(logic.post(Event::ButtonEvent));
+        EXPECT_FALSE(mock.debounceTimer.isEnabled());
+        EXPECT_FALSE(mock.toggleTimer.isEnabled());
+    }
+
+    // Case 2 - Post button events until the queue is full, expect further events to be dropped.
+    {
+        std::uint16_t postCount{1U};
+        while ((UINT8_MAX > postCount) && logic.post(Event::ButtonEvent)) { postCount++; }
+        EXPECT_LT(postCount, UINT8_MAX);
+        EXPECT_FALSE(logic.post(Event::ButtonEvent));
+    }
+
+    // Case 3 - Run the system, expect the queued events to be handled.
+    // Expect the toggle timer to be enabled, since the button activity while debouncing is 
+    // ignored, i.e. only the first button event is handled as a button press.
+    {
+        mock.runSystem();
+        mock.toggleButton.write(false);
+        EXPECT_TRUE(mock.debounceTimer.isEnabled());
+        EXPECT_TRUE(mock.toggleTimer.isEnabled());
+    }
+
+    // Case 4 - Post another event, expect it to be accepted, since the queue has been drained.
+    {
+        EXPECT_TRUE(logic.post(Event::DebounceTimerTimeout));
+        mock.runSystem();
+        EXPECT_TRUE(mock.toggleButton.isInterruptEnabled());
+        EXPECT_FALSE(mock.debounceTimer.isEnabled());
+    }
+}
+
+/**
+ * @brief Tick handling test.
+ *
+ *        Verify that ticks are counted while a task is running, so deadline misses are detected.
+ */
+TEST(Logic, TickHandling)
+{
+    // Create logic implementation with a sensor simulating ticks while the sampling task runs.
+    // Use a 10 ms tick, i.e. the tasks are released every 100 ticks with a deadline of 10 ticks.
+    Mock mock{};
+    bool stop{false};
+    TickingSensor sensor{mock.tickTimer, stop};
+    mock.tickTimer.setTimeout_ms(10U);
+    logic::Stub logic{Logic::LedGroup{mock.led}, Logic::ToggleButtonGroup{mock.toggleButton}, 
+                      Logic::TempButtonGroup{mock.tempButton}, mock.debounceTimer, 
+                      mock.toggleTimer, mock.tickTimer, mock.serial, mock.watchdog, mock.eeprom, 
+                      Logic::TempSensorGroup{sensor}, mock.power};
+    EXPECT_TRUE(mock.tickTimer.isEnabled());
+
+    // Simulate the given number of tick timer timeouts before running the system.
+    auto tick{[&](const std::uint8_t tickCount)
+    {
+        for (std::uint8_t i{}; i < tickCount; ++i)
+        {
+            mock.tickTimer.setTimedOut(true);
+            logic.handleTickTimerTimeout();
+        }
+    }};
+
+    // Case 1 - Release the sampling task, simulate a few ticks while it's running.
+    // Expect no deadline miss, since the task completed within its deadline.
+    {
+        sensor.attach(logic, 3U);
+        tick(100U);
+        logic.run(stop);
+        EXPECT_TRUE(stop);
+        EXPECT_EQ(0U, logic.deadlineMissCount());
+    }
+
+    // Case 2 - Release the sampling task again, simulate more ticks than the deadline while 
+    // it's running.
+    // Expect a deadline miss, since the ticks were counted while the task was running.
+    {
+        stop = false;
+        sensor.attach(logic, 20U);
+        tick(100U);
+        logic.run(stop);
+        EXPECT_TRUE(stop);
+        EXPECT_EQ(1U, logic.deadlineMissCount());
+    }
+}
 } // namespace
 } // namespace logic
 
 #endif /** TESTSUITE */
-
-//! @todo Remove this #endif once all stubs are implemented!
-#endif /** STUBS_IMPLEMENTED */
@@ -0,0 +1,176 @@
+/**
+ * @brief Unit tests for the cooperative task scheduler.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "scheduler/scheduler.h"
+
+#ifdef TESTSUITE
+
+namespace scheduler
+{
+namespace
+{
+/**
+ * @brief Structure holding the run history of the test tasks.
+ */
+struct History
+{
+    /** Maximum number of recorded runs. */
+    static constexpr std::uint8_t MaxRunCount{16U};
+
+    /** IDs of the tasks in the order they were run. */
+    std::uint8_t runs[MaxRunCount];
+
+    /** The number of recorded runs. */
+    std::uint8_t runCount;
+
+    /** Scheduler to tick while running the slow task. */
+    Scheduler* scheduler;
+
+    /** The number of ticks elapsing while running the slow task. */
+    std::uint8_t slowTicks;
+};
+
+/** Run history of the test tasks. */
+History myHistory{};
+
+// -----------------------------------------------------------------------------
+template <std::uint8_t Id>
+void task(void*) noexcept
+{
+    if (History::MaxRunCount > myHistory.runCount) { myHistory.runs[myHistory.runCount++] = Id; }
+}
+
+// -----------------------------------------------------------------------------
+void slowTask(void* context) noexcept
+{
+    // Simulate ticks elapsing while the task is running.
+    auto& history{*static_cast<History*>(context)};
+    for (std::uint8_t i{}; i < history.slowTicks; ++i) { history.scheduler->tick(); }
+}
+
+// -----------------------------------------------------------------------------
+void tick(Scheduler& scheduler, const std::uint8_t tickCount) noexcept
+{
+    for (std::uint8_t i{}; i < tickCount; ++i) { scheduler.tick(); }
+}
+
+/**
+ * @brief Scheduler release test.
+ * 
+ *        Verify that periodic and one-shot tasks are released on time and run in priority
+ *        order.
+ */
+TEST(Scheduler_Scheduler, Release)
+{
+    Scheduler scheduler{};
+    myHistory = History{};
+
+    // Case 1 - Verify that invalid tasks are rejected.
+    {
+        EXPECT_FALSE(scheduler.addTask(Scheduler::MaxTaskCount, 
+                                       Task{task<0U>, nullptr, 1U, 0U, 0U, 0U}));
+        EXPECT_FALSE(scheduler.addTask(0U, Task{nullptr, nullptr, 1U, 0U, 0U, 0U}));
+        EXPECT_FALSE(scheduler.schedule(0U, 1U));
+        EXPECT_EQ(scheduler.taskMask(), 0U);
+    }
+
+    // Case 2 - Add a periodic task with low priority and a one-shot task with high priority,
+    // both released after two ticks. Expect the one-shot task to run first.
+    {
+        EXPECT_TRUE(scheduler.addTask(1U, Task{task<1U>, nullptr, 2U, 2U, 0U, 5U}));
+        EXPECT_TRUE(scheduler.addTask(6U, Task{task<6U>, nullptr, 0U, 2U, 0U, 0U}));
+        EXPECT_EQ(scheduler.taskMask(), (1U << 1U) | (1U << 6U));
+
+        tick(scheduler, 1U);
+        EXPECT_FALSE(scheduler.isIdle());
+        EXPECT_EQ(scheduler.run(), 0U);
+        EXPECT_TRUE(scheduler.isIdle());
+
+        tick(scheduler, 1U);
+        EXPECT_EQ(scheduler.run(), 2U);
+        ASSERT_EQ(myHistory.runCount, 2U);
+        EXPECT_EQ(myHistory.runs[0U], 6U);
+        EXPECT_EQ(myHistory.runs[1U], 1U);
+    }
+
+    // Case 3 - Expect only the periodic task to be released again.
+    {
+        tick(scheduler, 4U);
+        EXPECT_EQ(scheduler.run(), 1U);
+        EXPECT_EQ(myHistory.runCount, 3U);
+        EXPECT_EQ(scheduler.tickCount(), 6U);
+    }
+
+    // Case 4 - Re-arm the one-shot task, expect it to be released immediately.
+    {
+        EXPECT_TRUE(scheduler.schedule(6U, 0U));
+        EXPECT_EQ(scheduler.run(), 1U);
+        EXPECT_EQ(myHistory.runs[3U], 6U);
+    }
+
+    // Case 5 - Remove the periodic task, expect it to no longer be released.
+    {
+        scheduler.removeTask(1U);
+        tick(scheduler, 10U);
+        EXPECT_EQ(scheduler.run(), 0U);
+        EXPECT_EQ(scheduler.taskMask(), (1U << 6U));
+    }
+}
+
+/**
+ * @brief Scheduler deadline test.
+ * 
+ *        Verify that tasks completing too late, or released again before running, are counted
+ *        as deadline misses.
+ */
+TEST(Scheduler_Scheduler, Deadlines)
+{
+    Scheduler scheduler{};
+    myHistory = History{};
+    myHistory.scheduler = &scheduler;
+
+    constexpr std::uint8_t slowId{2U};
+    constexpr std::uint8_t fastId{3U};
+
+    // Add a slow task with a deadline of two ticks and a fast task with higher priority.
+    EXPECT_TRUE(scheduler.addTask(slowId, Task{slowTask, &myHistory, 4U, 1U, 2U, 1U}));
+    EXPECT_TRUE(scheduler.addTask(fastId, Task{task<fastId>, nullptr, 8U, 1U, 0U, 0U}));
+
+    // Case 1 - Expect no deadline miss if the slow task completes within its deadline.
+    {
+        myHistory.slowTicks = 2U;
+        tick(scheduler, 1U);
+        EXPECT_EQ(scheduler.run(), 2U);
+        ASSERT_EQ(myHistory.runCount, 1U);
+        EXPECT_EQ(myHistory.runs[0U], fastId);
+        EXPECT_EQ(scheduler.deadlineMissCount(slowId), 0U);
+        EXPECT_EQ(scheduler.deadlineMissCount(), 0U);
+    }
+
+    // Case 2 - Expect a deadline miss if the slow task exceeds its deadline.
+    {
+        myHistory.slowTicks = 3U;
+        tick(scheduler, 2U);
+        EXPECT_EQ(scheduler.run(), 1U);
+        EXPECT_EQ(scheduler.deadlineMissCount(slowId), 1U);
+        EXPECT_EQ(scheduler.deadlineMissCount(fastId), 0U);
+    }
+
+    // Case 3 - Release the slow task twice before running it. Expect two more deadline misses,
+    // one for the merged release and one for completing too late after the first release.
+    {
+        myHistory.slowTicks = 0U;
+        tick(scheduler, 8U);
+        EXPECT_EQ(scheduler.run(), 2U);
+        EXPECT_EQ(scheduler.deadlineMissCount(slowId), 3U);
+        EXPECT_EQ(scheduler.deadlineMissCount(), 3U);
+    }
+}
+} // namespace
+} // namespace scheduler
+
+#endif /** TESTSUITE */
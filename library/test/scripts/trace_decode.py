@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Python script for decoding trace dumps printed by diag::trace::print.
+
+    The script reads a serial log (from a file or stdin), extracts each trace dump
+    between the "TRACE BEGIN" and "TRACE END" lines and prints it as a timeline.
+
+    Each record holds a 16-bit timestamp counted in 0.5 us, which wraps around every
+    32.768 ms. Successive records are assumed to be less than one wraparound apart.
+
+    Usage:
+    
+                        python3 trace_decode.py [serial_log.txt]
+"""
+import sys
+
+# Time per timestamp count in microseconds.
+US_PER_COUNT = 0.5
+
+# Timestamp wraparound in counts.
+TIME_WRAP = 1 << 16
+
+# Event names, indexed by event ID. Keep in sync with diag::trace::Id in include/diag/trace.h.
+EVENT_NAMES = [
+    "LogicEvent",
+    "TaskStart",
+    "TaskEnd",
+    "Sleep",
+    "Wake",
+    "EepromWrite",
+    "Temperature",
+    "DeadlineMiss",
+]
+
+# Logic event names, indexed by logic::Event value (see include/logic/interface.h).
+LOGIC_EVENT_NAMES = [
+    "None",
+    "ButtonEvent",
+    "DebounceTimerTimeout",
+    "ToggleTimerTimeout",
+    "TickTimerTimeout",
+    "WatchdogTimeout",
+]
+
+
+def parse_dumps(lines):
+    """Extract the trace dumps from the given lines.
+
+    Args:
+        lines: Lines of the serial log.
+
+    Returns:
+        List of dumps, where each dump is a list of (id, time, arg) tuples.
+    """
+    dumps = []
+    records = None
+
+    for line in lines:
+        line = line.strip()
+        if line.startswith("TRACE BEGIN"):
+            records = []
+        elif line.startswith("TRACE END"):
+            if records is not None:
+                dumps.append(records)
+            records = None
+        elif records is not None:
+            fields = line.split()
+            if len(fields) == 3:
+                records.append(tuple(int(field, 16) for field in fields))
+    return dumps
+
+
+def describe(event_id, arg):
+    """Get a readable description of the given event.
+
+    Args:
+        event_id: The event ID.
+        arg: The event argument.
+
+    Returns:
+        The event description.
+    """
+    name = EVENT_NAMES[event_id] if event_id < len(EVENT_NAMES) else f"Event{event_id}"
+
+    if name == "LogicEvent" and arg < len(LOGIC_EVENT_NAMES):
+        return f"{name} {LOGIC_EVENT_NAMES[arg]}"
+    if name == "Temperature":
+        # The temperature is a signed 16-bit value.
+        return f"{name} {arg - TIME_WRAP if arg & 0x8000 else arg} C"
+    if name == "EepromWrite":
+        return f"{name} 0x{arg:03X}"
+    if name in ("Sleep", "Wake"):
+        return name
+    return f"{name} {arg}"
+
+
+def print_timeline(records):
+    """Print the given records as a timeline relative to the first record.
+
+    Args:
+        records: List of (id, time, arg) tuples, oldest first.
+    """
+    print(f"{'time [us]':>12} {'delta [us]':>12}  event")
+    elapsed = 0
+    previous = None
+
+    for event_id, time, arg in records:
+        # Unwrap the timestamps, the delta is always within one wraparound.
+        delta = 0 if previous is None else (time - previous) % TIME_WRAP
+        elapsed += delta
+        previous = time
+        print(f"{elapsed * US_PER_COUNT:12.1f} {delta * US_PER_COUNT:12.1f}  "
+              f"{describe(event_id, arg)}")
+
+
+def main():
+    """Decode the trace dumps of the given serial log, or stdin if no log is given."""
+    if len(sys.argv) > 1:
+        with open(sys.argv[1], encoding="utf-8", errors="replace") as log:
+            dumps = parse_dumps(log)
+    else:
+        dumps = parse_dumps(sys.stdin)
+
+    if not dumps:
+        print("No trace dumps found!")
+        return
+
+    for index, records in enumerate(dumps):
+        print(f"Trace {index + 1} ({len(records)} records):")
+        print_timeline(records)
+        print()
+
+
+if __name__ == "__main__":
+    main()
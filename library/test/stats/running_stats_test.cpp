@@ -0,0 +1,134 @@
+/**
+ * @brief Unit tests for the streaming statistics.
+ */
+#include <cmath>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "stats/running_stats.h"
+
+#ifdef TESTSUITE
+
+namespace stats
+{
+namespace
+{
+/** Value of 1 in fixed-point format. */
+constexpr double Scale{1U << RunningStats::Shift};
+
+/** Tolerance used when comparing fixed-point values, in fixed-point steps. */
+constexpr double Tolerance{2.0};
+
+/**
+ * @brief Streaming statistics test.
+ * 
+ *        Verify that the streaming statistics match the statistics computed over all samples.
+ */
+TEST(Stats_RunningStats, Statistics)
+{
+    RunningStats stats{1U};
+    constexpr std::int16_t samples[]{21, 23, 22, 26, 20, 24};
+    constexpr std::uint8_t sampleCount{sizeof(samples) / sizeof(samples[0U])};
+
+    // Case 1 - Expect all statistics to be 0 before any sample has been added.
+    {
+        EXPECT_EQ(stats.count(), 0U);
+        EXPECT_EQ(stats.mean_q8(), 0);
+        EXPECT_EQ(stats.variance_q8(), 0U);
+        EXPECT_EQ(stats.ewma_q8(), 0);
+    }
+
+    // Case 2 - Add the samples, expect the statistics to match the reference values.
+    {
+        double sum{}, ewma{static_cast<double>(samples[0U])};
+
+        for (std::uint8_t i{}; i < sampleCount; ++i) 
+        { 
+            stats.add(samples[i]); 
+            sum += samples[i];
+            if (0U < i) { ewma += 0.5 * (samples[i] - ewma); }
+        }
+
+        const double mean{sum / sampleCount};
+        double sumSquares{};
+        for (const auto& sample : samples) { sumSquares += (sample - mean) * (sample - mean); }
+        const double variance{sumSquares / (sampleCount - 1U)};
+
+        EXPECT_EQ(stats.count(), sampleCount);
+        EXPECT_NEAR(stats.mean_q8(), mean * Scale, Tolerance);
+        EXPECT_NEAR(stats.variance_q8(), variance * Scale, Tolerance);
+        EXPECT_NEAR(stats.stdDev_q8(), std::sqrt(variance) * Scale, Tolerance);
+        EXPECT_EQ(stats.mean(), std::round(mean));
+        EXPECT_EQ(stats.stdDev(), std::round(std::sqrt(variance)));
+        EXPECT_EQ(stats.min(), 20);
+        EXPECT_EQ(stats.max(), 26);
+        EXPECT_NEAR(stats.ewma_q8(), ewma * Scale, Tolerance);
+    }
+
+    // Case 3 - Reset the statistics, expect the EWMA to continue from its previous value.
+    {
+        const std::int32_t ewma{stats.ewma_q8()};
+        stats.reset();
+        EXPECT_EQ(stats.count(), 0U);
+        EXPECT_EQ(stats.variance_q8(), 0U);
+        EXPECT_EQ(stats.ewma_q8(), ewma);
+
+        stats.add(30);
+        EXPECT_EQ(stats.mean(), 30);
+        EXPECT_EQ(stats.min(), 30);
+        EXPECT_EQ(stats.max(), 30);
+        EXPECT_NEAR(stats.ewma_q8(), ewma + 0.5 * (30.0 * Scale - ewma), Tolerance);
+    }
+}
+
+/**
+ * @brief Numerical stability test.
+ * 
+ *        Verify that the variance stays accurate for samples with a large offset, and that the
+ *        EWMA keeps running once the sample counter saturates.
+ */
+TEST(Stats_RunningStats, Stability)
+{
+    RunningStats stats{};
+    constexpr std::int16_t offset{10000};
+
+    // Case 1 - Add alternating samples around a large offset, expect a sample variance of 
+    //          1.0 * n/(n-1).
+    {
+        constexpr std::uint16_t sampleCount{1000U};
+        for (std::uint16_t i{}; i < sampleCount; ++i) 
+        { 
+            stats.add(offset + (i % 2U ? 1 : -1)); 
+        }
+        EXPECT_NEAR(stats.mean_q8(), offset * Scale, Tolerance);
+        EXPECT_NEAR(stats.variance_q8(), Scale * sampleCount / (sampleCount - 1.0), Tolerance);
+        EXPECT_EQ(stats.stdDev(), 1);
+    }
+
+    // Case 2 - Saturate the sample counter, expect the EWMA to follow new samples.
+    {
+        stats.reset();
+        for (std::uint32_t i{}; i < UINT16_MAX; ++i) { stats.add(offset); }
+        EXPECT_EQ(stats.count(), UINT16_MAX);
+
+        for (std::uint8_t i{}; i < 100U; ++i) { stats.add(-offset); }
+        EXPECT_EQ(stats.count(), UINT16_MAX);
+        EXPECT_EQ(stats.mean(), offset);
+        EXPECT_EQ(stats.ewma(), -offset);
+    }
+
+    // Case 3 - Add alternating samples far apart until the sum of squares saturates.
+    // Expect the variance to stay at its saturated value rather than wrapping around.
+    {
+        constexpr std::uint16_t sampleCount{2000U};
+        stats.reset();
+        for (std::uint16_t i{}; i < sampleCount; ++i) { stats.add(i % 2U ? offset : -offset); }
+        EXPECT_EQ(stats.variance_q8(), UINT32_MAX / (sampleCount - 1U));
+        EXPECT_LT(0, stats.stdDev());
+    }
+}
+} // namespace
+} // namespace stats
+
+#endif /** TESTSUITE */
@@ -0,0 +1,108 @@
+/**
+ * @brief Unit tests for the heap accounting.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "container/list.h"
+#include "container/vector.h"
+#include "utils/heap.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace utils
+{
+namespace
+{
+/**
+ * @brief Heap accounting test.
+ * 
+ *        Verify that allocations, reallocations and deallocations are accounted for.
+ */
+TEST(Utils_Heap, Accounting)
+{
+    // Heap accounting is enabled in the test suite.
+    ASSERT_TRUE(heap::isEnabled());
+    heap::reset();
+    const heap::Stats initial{heap::stats()};
+
+    // Case 1 - Allocate a field of 10 integers, expect 40 live bytes.
+    std::int32_t* field{newMemory<std::int32_t>(10U)};
+    {
+        ASSERT_NE(field, nullptr);
+        const heap::Stats stats{heap::stats()};
+        EXPECT_EQ(stats.liveBytes - initial.liveBytes, 40U);
+        EXPECT_EQ(stats.liveBlocks - initial.liveBlocks, 1U);
+        EXPECT_EQ(stats.allocCount, 1U);
+        EXPECT_EQ(heap::siteCount(), 1U);
+    }
+
+    // Case 2 - Shrink the field to 5 integers, expect the peak usage to be kept.
+    {
+        field = reallocMemory(field, 5U);
+        ASSERT_NE(field, nullptr);
+        const heap::Stats stats{heap::stats()};
+        EXPECT_EQ(stats.liveBytes - initial.liveBytes, 20U);
+        EXPECT_EQ(stats.peakBytes - initial.liveBytes, 40U);
+        EXPECT_EQ(stats.reallocCount, 1U);
+    }
+
+    // Case 3 - Delete the field, expect no remaining live bytes.
+    {
+        deleteMemory(field);
+        EXPECT_EQ(field, nullptr);
+        const heap::Stats stats{heap::stats()};
+        EXPECT_EQ(stats.liveBytes, initial.liveBytes);
+        EXPECT_EQ(stats.liveBlocks, initial.liveBlocks);
+        EXPECT_EQ(stats.freeCount, 1U);
+        EXPECT_EQ(stats.failedCount, 0U);
+    }
+}
+
+/**
+ * @brief Allocation budget test.
+ * 
+ *        Verify the number of heap operations and the memory used by container operations.
+ */
+TEST(Utils_Heap, Budget)
+{
+    heap::reset();
+    const heap::Stats initial{heap::stats()};
+
+    // Case 1 - Push back to a vector, expect one (re)allocation per value and no overhead.
+    {
+        container::Vector<std::int16_t> vector{};
+
+        for (std::int16_t i{}; i < 10; ++i) { EXPECT_TRUE(vector.pushBack(i)); }
+        const heap::Stats stats{heap::stats()};
+        EXPECT_EQ(stats.allocCount + stats.reallocCount, 10U);
+        EXPECT_EQ(stats.peakBytes - initial.liveBytes, 10U * sizeof(std::int16_t));
+    }
+
+    // Case 2 - Verify that the vector released its memory when it went out of scope.
+    {
+        const heap::Stats stats{heap::stats()};
+        EXPECT_EQ(stats.freeCount, 1U);
+        EXPECT_EQ(stats.liveBlocks, initial.liveBlocks);
+        EXPECT_EQ(stats.liveBytes, initial.liveBytes);
+    }
+
+    // Case 3 - Push back to a list, expect one node allocation per value and no leaks.
+    {
+        heap::reset();
+        {
+            container::List<std::int16_t> list{};
+            for (std::int16_t i{}; i < 5; ++i) { list.pushBack(i); }
+            EXPECT_EQ(heap::stats().allocCount, 5U);
+            EXPECT_EQ(heap::stats().reallocCount, 0U);
+        }
+        EXPECT_EQ(heap::stats().freeCount, 5U);
+        EXPECT_EQ(heap::stats().liveBlocks, initial.liveBlocks);
+    }
+}
+} // namespace
+} // namespace utils
+
+#endif /** TESTSUITE */